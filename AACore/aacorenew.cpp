@@ -12,8 +12,11 @@
 #include <QPainter>
 #include "aa_util.h"
 #include "utils/commonutils.h"
+#include "cycletracerecorder.h"
+#include "computepool.h"
 #include "vision/visionmodule.h"
 #include <QFuture>
+#include <QWaitCondition>
 #include <QtConcurrent/QtConcurrent>
 #include "sfr.h"
 #define PI  3.14159265
@@ -24,6 +27,16 @@
 #include "utils/uiHelper/uioperation.h"
 #include "utils/singletoninstances.h"
 
+//调试存图放到计算池后台编码, 不占用AA测试时间
+static void saveImageInBackground(QString imageName, cv::Mat image)
+{
+    //取图缓存会被下一帧覆盖, 先深拷贝
+    cv::Mat copy = image.clone();
+    ComputePool::instance()->submit([imageName, copy]() {
+        cv::imwrite(imageName.toStdString().c_str(), copy);
+    }, ComputePool::Background);
+}
+
 vector<double> fitCurve(const vector<double> & x, const vector<double> & y, int order, double & localMaxX,
                         double & localMaxY, double & error_avg, double & error_dev, vector<double> & y_output, bool & detectedAbnormality, int deletedIndex, double deletedValue = 0, int errorThreshold = -10) {
     size_t n = x.size();
@@ -148,8 +161,6 @@ typedef enum {
     AA_XSCAN_MODE //Special AA scan mode for KunLunShan project
 } ZSCAN_MODE;
 
-AACoreNew * that;
-
 AACoreNew::AACoreNew(QString name, QObject *parent):ThreadWorkerBase (name)
 {
     Q_UNUSED(name)
@@ -159,7 +170,6 @@ AACoreNew::AACoreNew(QString name, QObject *parent):ThreadWorkerBase (name)
 void AACoreNew::Init(AAHeadModule *aa_head, SutModule *sut, Dothinkey *dk, ChartCalibration *chartCalibration,
                      DispenseModule *dispense, ImageGrabbingWorkerThread *imageThread, Unitlog *unitlog, int serverMode)
 {
-    that = this;
     setName(parameters.moduleName());
     this->aa_head = aa_head;
     this->lut = lut;
@@ -207,6 +217,7 @@ void AACoreNew::run(bool has_material)
         qInfo("AACore is running");
         timer.restart();
         runningUnit = this->unitlog->createUnit();
+        CycleTraceRecorder::instance()->setCurrentUnit(runningUnit);
         //Reset some previous result
         oc_fov = -1;
         hasDispense = false;
@@ -461,6 +472,7 @@ void AACoreNew::startWork( int run_mode)
     if (run_mode == RunMode::AAFlowChartTest) {
         QElapsedTimer timer;timer.start();
         runningUnit = this->unitlog->createUnit();
+        CycleTraceRecorder::instance()->setCurrentUnit(runningUnit);
         runFlowchartTest();
         emit postDataToELK(this->runningUnit, this->parameters.lotNumber());
         double temp_time = timer.elapsed();
@@ -581,6 +593,7 @@ void AACoreNew::performHandlingOperation(int cmd,QVariant param)
     QJsonValue params = jsonDoc.object();
 
     runningUnit = this->unitlog->createUnit();
+    CycleTraceRecorder::instance()->setCurrentUnit(runningUnit);
     if (cmd == HandleTest::Dispense)
     {
         sut->DownlookPrDone = false;
@@ -677,7 +690,7 @@ void AACoreNew::performHandlingOperation(int cmd,QVariant param)
         performParticalCheck(params);
     }
     emit postDataToELK(this->runningUnit, this->parameters.lotNumber());
-    is_handling = false;
+    finishHandling();
 }
 
 void AACoreNew::resetLogic()
@@ -710,167 +723,105 @@ void AACoreNew::resetLogic()
     sumX = 0; sumY = 0; sumZ = 0;
 }
 
+QSharedPointer<const FlowchartGraph> AACoreNew::currentFlowchartGraph()
+{
+    //流程图只在更新后编译一次
+    QMutexLocker locker(&flowchart_mutex);
+    if(flowchart_graph.isNull()||flowchart_graph->isGrouped() != parameters.parallelTestItems())
+    {
+        QElapsedTimer timer; timer.start();
+        QString error;
+        QSharedPointer<FlowchartGraph> graph(new FlowchartGraph());
+        if(!graph->compile(flowchartDocument.object(),error,parameters.parallelTestItems()))
+        {
+            qWarning("compile flowchart fail: %s",error.toStdString().c_str());
+            return QSharedPointer<const FlowchartGraph>();
+        }
+        qInfo("compile flowchart nodes %d links %d time %lld us",graph->nodeCount(),graph->linkCount(),timer.nsecsElapsed()/1000);
+        flowchart_graph = graph;
+    }
+    return flowchart_graph;
+}
+
 bool AACoreNew::runFlowchartTest()
 {
     qInfo("aaAutoTest Started");
-    QVariantMap jsonMap = flowchartDocument.object().toVariantMap();
-    QJsonObject links = jsonMap["links"].toJsonObject();
-    QJsonObject operators = jsonMap["operators"].toJsonObject();
-    bool end = false;
-    QString currentPointer = "start";
-    while (!end)
+    //整个单元使用开始时的流程图, 运行中更新流程图不影响本次
+    QSharedPointer<const FlowchartGraph> graph_pointer = currentFlowchartGraph();
+    if(graph_pointer.isNull())
     {
-        end = true;
-        foreach(const QString &key, links.keys()){
-            QJsonValue value = links.value(key);
-            if (value["fromOperator"].toString() == currentPointer
-                    && value["fromConnector"].toString() == "success") {
-                if (currentPointer == "start") {
-                    QVariantMap map;
-                    map.insert("Time", getCurrentTimeString());
-                    emit pushDataToUnit(runningUnit, "FlowChart_StartTime", map);    //Add a_ to make it first in map sorting
-
-                    qInfo(QString("Move from " + currentPointer + " to " + value["toOperator"].toString()).toStdString().c_str());
-                    currentPointer = value["toOperator"].toString();
-                    if (links.size() == 1) {
-                        QJsonValue op = operators[currentPointer.toStdString().c_str()];
-                        ErrorCodeStruct ret_error = performTest(currentPointer.toStdString().c_str(), op["properties"]);
-                    }
-                    end = false;
-                    break;
-                }
-                else {
-                    qInfo(QString("Do Test:" + currentPointer).toStdString().c_str());
-                    QJsonValue op = operators[currentPointer.toStdString().c_str()];
-                    //Choose Path base on the result
-                    ErrorCodeStruct ret_error = performTest(currentPointer.toStdString().c_str(), op["properties"]);
-                    bool ret = true;
-                    if (ret_error.code != ErrorCode::OK) ret = false;
-                    if (ret) {
-                        currentPointer = value["toOperator"].toString();
-                    } else {
-                        //Find fail path
-                        bool hasFailPath = false;
-                        foreach(const QString &key, links.keys()){
-                            QJsonValue value = links.value(key);
-                            if (value["fromOperator"].toString() == currentPointer
-                                    && value["fromConnector"].toString() == "fail") {
-                                currentPointer = value["toOperator"].toString();
-                                hasFailPath = true;
-                                break;
-                            }
-                        }
-                        if (!hasFailPath) {
-                            qInfo("Finished With Auto Reject");
-                            performReject();
-                            end = true;
-                            break;
-                        }
-                    }
-                    if (currentPointer.contains("Accept")
-                            ||currentPointer.contains("Reject")
-                            ||currentPointer.contains("Terminate")) {
-                        QJsonValue op = operators[currentPointer.toStdString().c_str()];
-                        ErrorCodeStruct ret_error = performTest(currentPointer.toStdString().c_str(), op["properties"]);
-                        qInfo("Finished With %s",currentPointer.toStdString().c_str());
-                        end = true;
-                        break;
-                    }
-                    end = false;
-                    break;
-                }
-            } else if ( value["fromOperator"].toString() == currentPointer
-                        && value["fromConnector"].toString() == "thread_1" ) {
-                qInfo("Found Parallel Test Item");
-                vector<QString> thread_1_test_list, thread_2_test_list;
-
-                QString current_thread_1 = currentPointer, current_thread_2 = currentPointer;
-                //Find the head first
-                bool isFoundThread_1 = false, isFoundThread_2 = false;
-                foreach(const QString &key, links.keys()){
-                    QJsonValue value = links.value(key);
-                    if (value["fromOperator"].toString() == current_thread_1 && value["fromConnector"] == "thread_1") {
-                        current_thread_1 = value["toOperator"].toString();
-                        isFoundThread_1 = true;
-                    } else if (value["fromOperator"].toString() == current_thread_2 && value["fromConnector"] == "thread_2") {
-                        current_thread_2 = value["toOperator"].toString();
-                        isFoundThread_2 = true;
-                    }
-                    if (isFoundThread_1 && isFoundThread_2) {
-                        thread_1_test_list.push_back(current_thread_1);
-                        thread_2_test_list.push_back(current_thread_2);
-                        break;
-                    }
-                }
-                //Traverse the thread
-                bool thread1End = false;
-                while (!thread1End)
-                {
-                    thread1End = true;
-                    foreach(const QString &key, links.keys()){
-                        QJsonValue value = links.value(key);
-                        if (value["fromOperator"].toString() == current_thread_1) {
-                            thread_1_test_list.push_back(value["toOperator"].toString());
-                            current_thread_1 = value["toOperator"].toString();
-                            thread1End = false;
-                            break;
-                        }
-                    }
-                    if (current_thread_1.contains("Join")) {
-                        thread1End = true;
-                    }
-                }
-                bool thread2End = false;
-                while (!thread2End)
-                {
-                    thread2End = true;
-                    foreach(const QString &key, links.keys()){
-                        QJsonValue value = links.value(key);
-                        if (value["fromOperator"].toString() == current_thread_2) {
-                            thread_2_test_list.push_back(value["toOperator"].toString());
-                            current_thread_2 = value["toOperator"].toString();
-                            thread2End = false;
-                            if (current_thread_2.contains("Join")) {
-                                currentPointer = current_thread_2;
-                                thread2End = true;
-                            }
-                            break;
-                        }
-                    }
-                }
-                qInfo("End of traversal: %s", jsonMap["operators"].toString().toStdString().c_str());
-                QJsonValue op1 = operators[thread_1_test_list[0].toStdString().c_str()];
-                QJsonValue op2 = operators[thread_2_test_list[0].toStdString().c_str()];
-                ErrorCodeStruct ret = performParallelTest(thread_1_test_list, thread_2_test_list, op1["properties"], op2["properties"]);
-                if (ret.code != ErrorCode::OK) {
-                    qInfo("Finished With Auto Reject");
-                    performReject();
-                    end = true;
-                    break;
-                }
-                //Perform Parallel Test
+        performReject();
+        return false;
+    }
+    const FlowchartGraph &graph = *graph_pointer;
+    QVariantMap map;
+    map.insert("Time", getCurrentTimeString());
+    emit pushDataToUnit(runningUnit, "FlowChart_StartTime", map);    //Add a_ to make it first in map sorting
+
+    int current = graph.node(graph.startNode()).success;
+    if(current >= 0)
+    {
+        qInfo("Move from start to %s",graph.node(current).name.toStdString().c_str());
+        if (graph.linkCount() == 1) {
+            const FlowchartNode &node = graph.node(current);
+            performTest(node.type, node.name, node.properties);
+        }
+    }
+    while (current >= 0)
+    {
+        const FlowchartNode &node = graph.node(current);
+        if (!node.branches.isEmpty()) {
+            qInfo("Found Parallel Test Item %s branches %d",node.name.toStdString().c_str(),node.branches.size());
+            ErrorCodeStruct ret = performFlowchartBranches(graph, current);
+            if (ret.code != ErrorCode::OK) {
+                qInfo("Finished With Auto Reject");
+                performReject();
+                break;
             }
+            current = node.join;
+            continue;
+        }
+        //没有成功出口的节点不执行
+        if (node.success < 0)
+            break;
+        if (!node.group.isEmpty()) {
+            ErrorCodeStruct ret = performParallelItems(graph, node.group);
+            if (ret.code != ErrorCode::OK) {
+                qInfo("Finished With Auto Reject");
+                performReject();
+                break;
+            }
+            current = graph.node(node.group.last()).success;
+        } else {
+            qInfo("Do Test:%s",node.name.toStdString().c_str());
+            //Choose Path base on the result
+            ErrorCodeStruct ret_error = performTest(node.type, node.name, node.properties);
+            if (ret_error.code == ErrorCode::OK) {
+                current = node.success;
+            } else if (node.fail >= 0) {
+                current = node.fail;
+            } else {
+                qInfo("Finished With Auto Reject");
+                performReject();
+                break;
+            }
+        }
+        const FlowchartNode &next = graph.node(current);
+        if (next.terminal) {
+            performTest(next.type, next.name, next.properties);
+            qInfo("Finished With %s",next.name.toStdString().c_str());
+            break;
         }
     }
 
-    QVariantMap map;
     map.insert("Time", getCurrentTimeString());
     emit pushDataToUnit(runningUnit, "FlowChart_TerminateTime", map);
 
     return true;
 }
 
-ErrorCodeStruct AACoreNew::performTest(QString testItemName, QJsonValue properties)
+void AACoreNew::checkGlueLevel()
 {
-    ErrorCodeStruct ret = { ErrorCode::OK, "" };
-    QString testName = properties["title"].toString();
-    runningTestName = testName;
-    QJsonValue params = properties["params"];
-    int retry_count = params["retry"].toInt(0);
-    QJsonValue delay_in_ms_qjv = params["delay_in_ms"];
-    unsigned int delay_in_ms = delay_in_ms_qjv.toInt(0);
-
-    //Do any pre check here
     if (dispense->dispenser->parameters.enableGlueLevelCheck()) {
         qInfo("Glue level check enabled");
         bool preCheckFail = dispense->dispenser->glueLevelCheck();
@@ -880,34 +831,64 @@ ErrorCodeStruct AACoreNew::performTest(QString testItemName, QJsonValue properti
             QString operation = waitMessageReturn(is_run,alarm_id);
         }
     }
+}
+
+void AACoreNew::setRunningTest(const QString &test_name, const QString &running_text)
+{
+    QMutexLocker locker(&test_state_mutex);
+    if (!test_name.isNull())
+        runningTestName = test_name;
+    parameters.setAACoreRunningTest(running_text);
+}
+
+QString AACoreNew::currentTestName()
+{
+    QMutexLocker locker(&test_state_mutex);
+    return runningTestName;
+}
+
+ErrorCodeStruct AACoreNew::performTest(int type, QString testItemName, QJsonValue properties, bool pre_check)
+{
+    TraceSpan trace_span("aa",__FUNCTION__,testItemName);
+    ErrorCodeStruct ret = { ErrorCode::OK, "" };
+    QString testName = properties["title"].toString();
+    QJsonValue params = properties["params"];
+    int retry_count = params["retry"].toInt(0);
+    QJsonValue delay_in_ms_qjv = params["delay_in_ms"];
+    unsigned int delay_in_ms = delay_in_ms_qjv.toInt(0);
+    setRunningTest(testName, "Running test: " + testItemName);
+
+    //Do any pre check here, 并行项目由调用线程预先检查
+    if (pre_check)
+        checkGlueLevel();
 
 
     for (int i = 0; i <= retry_count; i++) {
-        parameters.setAACoreRunningTest("Running test: " + testItemName);
-        if (testItemName.contains(AA_PIECE_START)) { qInfo("Performing Start"); }
-        else if (testItemName.contains(AA_PIECE_LOAD_CAMERA)) {
+        setRunningTest(QString(), "Running test: " + testItemName);
+        if (type == FlowchartGraph::Start) { qInfo("Performing Start"); }
+        else if (type == FlowchartGraph::LoadCamera) {
             qInfo("Performing load camera");
         }
-        else if (testItemName.contains(AA_PIECE_INIT_LENS)) {
+        else if (type == FlowchartGraph::InitLens) {
             int finish_delay = params["delay_in_ms"].toInt(0);
             double target_position = params["target_position"].toDouble();
             qInfo("Performing init lens :%d position %f",finish_delay,target_position);
             ret = performVCMInit(params);
             qInfo("End of init camera %s",ret.errorMessage.toStdString().c_str());
         }
-        else if (testItemName.contains(AA_PIECE_INIT_CAMERA)) {
+        else if (type == FlowchartGraph::InitCamera) {
             int finish_delay = params["delay_in_ms"].toInt(0);
             qInfo("Performing init camera :%d",finish_delay);
             ret = performInitSensor(finish_delay);
             qInfo("End of init camera %s",ret.errorMessage.toStdString().c_str());
         }
-        else if (testItemName.contains(AA_PIECE_PR_TO_BOND)) {
+        else if (type == FlowchartGraph::PrToBond) {
             int finish_delay = params["delay_in_ms"].toInt(0);
             qInfo("Performing PR To Bond :%d",finish_delay);
             ret = performPRToBond(finish_delay);
             qInfo("End of perform PR To Bond %s",ret.errorMessage.toStdString().c_str());
         }
-        else if (testItemName.contains(AA_PIECE_INITIAL_TILT)) {
+        else if (type == FlowchartGraph::InitialTilt) {
             qInfo("Performing Initial Tilt");
             double initial_roll = params["roll"].toDouble(0);
             double initial_pitch = params["pitch"].toDouble(0);
@@ -917,43 +898,43 @@ ErrorCodeStruct AACoreNew::performTest(QString testItemName, QJsonValue properti
                 Sleep(finish_delay);
             qInfo("End of perform initial tilt");
         }
-        else if (testItemName.contains(AA_PIECE_Z_OFFSET)) {
+        else if (type == FlowchartGraph::ZOffset) {
             qInfo("Performing Z Offset");
             performZOffset(params);
             qInfo("End of perform z offset");
         }
-        else if (testItemName.contains(AA_PIECE_XY_OFFSET)) {
+        else if (type == FlowchartGraph::XYOffset) {
             qInfo("Performing XY Offset");
             performXYOffset(params);
             qInfo("End of perform xy offset");
         }
-        else if (testItemName.contains(AA_PIECE_LOAD_MATERIAL)) {
+        else if (type == FlowchartGraph::LoadMaterial) {
             int finish_delay = params["delay_in_ms"].toInt(0);
             qInfo("Performing Load Material :%d",finish_delay);
             ret = performLoadMaterial(finish_delay);
             qInfo("End of perform Load Material %s",ret.errorMessage.toStdString().c_str());
         }
-        else if (testItemName.contains(AA_PIECE_UNLOAD_LENS)) {
+        else if (type == FlowchartGraph::UnloadLens) {
             qInfo("Performing AA unload lens");
         }
-        else if (testItemName.contains(AA_UNLOAD_CAMERA)) {
+        else if (type == FlowchartGraph::UnloadCamera) {
 
             int finish_delay = params["delay_in_ms"].toInt(0);
             qInfo("AA Unload Camera delay %d",finish_delay);
             ret = performCameraUnload(finish_delay);
             qInfo("End of perform unload camera %s",ret.errorMessage.toStdString().c_str());
         }
-        else if (testItemName.contains(AA_PIECE_OC)) {
+        else if (type == FlowchartGraph::OC) {
             qInfo("Performing OC %s",params.toString().toStdString().c_str());
             ret = performOC(params);
             qInfo("End of perform OC %s",ret.errorMessage.toStdString().c_str());
         }
-        else if (testItemName.contains(AA_PIECE_Y_LEVEL)) {
+        else if (type == FlowchartGraph::YLevel) {
             qInfo("Performing Y Level");
             ret = performYLevelTest(params);
             qInfo("End of perform Y Level %s", ret.errorMessage.toStdString().c_str());
         }
-        else if (testItemName.contains(AA_PIECE_AA)) {
+        else if (type == FlowchartGraph::AA) {
             qInfo("Performing AA");
             if (currentChartDisplayChannel == 0) {
                 aaData_1.setInProgress(true);
@@ -965,51 +946,51 @@ ErrorCodeStruct AACoreNew::performTest(QString testItemName, QJsonValue properti
             aaData_2.setInProgress(false);
             qInfo("End of perform AA %s",ret.errorMessage.toStdString().c_str());
         }
-        else if (testItemName.contains(AA_PIECE_MTF)) {
+        else if (type == FlowchartGraph::MTF) {
             qInfo("Performing MTF");
             ret = performMTFNew(params);
             qInfo("End of perform MTF %s",ret.errorMessage.toStdString().c_str());
         }
-        else if (testItemName.contains(AA_PIECE_UV)) {
+        else if (type == FlowchartGraph::UV) {
             qInfo("Performing UV");
             ret = performUV(params);
             qInfo("End of perform UV %s",ret.errorMessage.toStdString().c_str());
         }
-        else if (testItemName.contains(AA_PIECE_OTP)) {
+        else if (type == FlowchartGraph::OTP) {
             qInfo("Performing OTP");
             ret = performOTP(params);
             qInfo("End of perform OTP %s",ret.errorMessage.toStdString().c_str());
         }
-        else if (testItemName.contains(AA_PIECE_DISPENSE)) {
+        else if (type == FlowchartGraph::Dispense) {
             qInfo("Performing Dispense",params.toString().toStdString().c_str());
             ret = performDispense(params);
             qInfo("End of perform Dispense %s",ret.errorMessage.toStdString().c_str());
         }
-        else if (testItemName.contains(AA_PIECE_DELAY)) {
+        else if (type == FlowchartGraph::Delay) {
             int delay_in_ms = params["delay_in_ms"].toInt();
             qInfo("Performing Delay : %d", delay_in_ms);
             performDelay(delay_in_ms);
             qInfo("End of perform Delay");
         }
-        else if (testItemName.contains(AA_PIECE_ACCEPT))
+        else if (type == FlowchartGraph::Accept)
         {
             qInfo("Performing Accept");
             performAccept();
             qInfo("End of perform Accept");
         }
-        else if (testItemName.contains(AA_PIECE_REJECT))
+        else if (type == FlowchartGraph::Reject)
         {
             qInfo("Performing Reject");
             performReject();
             qInfo("End of perform Reject");
         }
-        else if (testItemName.contains(AA_PIECE_TERMINATE))
+        else if (type == FlowchartGraph::Terminate)
         {
             qInfo("Performing Terminate");
             performTerminate();
             qInfo("End of perform Terminate");
         }
-        else if (testItemName.contains(AA_PIECE_GRR))
+        else if (type == FlowchartGraph::GRR)
         {
             bool change_lens = params["change_lens"].toInt();
             bool change_sensor = params["change_sensor"].toInt();
@@ -1019,17 +1000,17 @@ ErrorCodeStruct AACoreNew::performTest(QString testItemName, QJsonValue properti
             performGRR(change_lens,change_sensor,repeat_time,change_time);
             qInfo("End of perform GRR");
         }
-        else if (testItemName.contains(AA_PIECE_JOIN))
+        else if (type == FlowchartGraph::Join)
         {
             qInfo("Performing Join");
         }
-        else if (testItemName.contains(AA_PIECE_SAVE_IMAGE))
+        else if (type == FlowchartGraph::SaveImage)
         {
             qInfo("Performing Save Image");
             int cameraChannel = params["type"].toInt();
             int lighting = params["lighting"].toInt();
         }
-        else if (testItemName.contains(AA_PIECE_PARTICAL_CHECK))
+        else if (type == FlowchartGraph::ParticalCheck)
         {
             qInfo("Performing Partical Check");
             performParticalCheck(params);
@@ -1039,62 +1020,159 @@ ErrorCodeStruct AACoreNew::performTest(QString testItemName, QJsonValue properti
     if (ret.code != ErrorCode::OK) {
         emit pushNgDataToCSV(this->runningUnit, parameters.lotNumber(), dk->readSensorID(), testItemName, ret.errorMessage);
     }
-    parameters.setAACoreRunningTest("");
+    setRunningTest(QString(), "");
     return ret;
 }
 
-bool AACoreNew::performThreadTest(vector<QString> testList, QJsonValue params)
+ErrorCodeStruct AACoreNew::performBranchTest(int type, QJsonValue params)
 {
     ErrorCodeStruct ret = ErrorCodeStruct {ErrorCode::OK, ""};
-    foreach(QString testName, testList) {
-        qInfo() << "Perform Test in thread : " << testName;
-        if (testName.contains(AA_PIECE_DELAY)) {
-            int delay_in_ms = params["delay_in_ms"].toInt();
-            that->performDelay(delay_in_ms);
-        } else if (testName.contains(AA_PIECE_Y_LEVEL)) {
-            ret = that->performYLevelTest(params);
-        } else if (testName.contains(AA_PIECE_UV)) {
-            ret = that->performUV(params);
-        } else if (testName.contains(AA_PIECE_PR_TO_BOND)) {
-            int finish_delay = params["delay_in_ms"].toInt();
-            qInfo("start performPRToBond :%d",finish_delay);
-            ret = that->performPRToBond(finish_delay);
-            qInfo("End performPRToBond %s",ret.errorMessage.toStdString().c_str());
-        } else if (testName.contains(AA_PIECE_INIT_CAMERA)) {
+    if (type == FlowchartGraph::Delay) {
+        int delay_in_ms = params["delay_in_ms"].toInt();
+        performDelay(delay_in_ms);
+    } else if (type == FlowchartGraph::YLevel) {
+        ret = performYLevelTest(params);
+    } else if (type == FlowchartGraph::UV) {
+        ret = performUV(params);
+    } else if (type == FlowchartGraph::PrToBond) {
+        int finish_delay = params["delay_in_ms"].toInt();
+        qInfo("start performPRToBond :%d",finish_delay);
+        ret = performPRToBond(finish_delay);
+        qInfo("End performPRToBond %s",ret.errorMessage.toStdString().c_str());
+    } else if (type == FlowchartGraph::InitCamera) {
+        int finish_delay = params["delay_in_ms"].toInt(0);
+        qInfo("Performing init camera :%d",finish_delay);
+        ret = performInitSensor(finish_delay);
+        qInfo("End performInitSensor %s",ret.errorMessage.toStdString().c_str());
+    } else if (type == FlowchartGraph::OTP) {
+        ret = performOTP(params);
+    }
+    return ret;
+}
 
-            int finish_delay = params["delay_in_ms"].toInt(0);
-            qInfo("Performing init camera :%d",finish_delay);
-            ret = that->performInitSensor(finish_delay);
-            qInfo("End performInitSensor %s",ret.errorMessage.toStdString().c_str());
-        } else if (testName.contains(AA_PIECE_OTP)) {
-            ret = that->performOTP(params);
-        }
+ErrorCodeStruct AACoreNew::performFlowchartBranch(const FlowchartGraph &graph, int current, int join)
+{
+    //沿成功出口执行到汇合节点, 任一项失败则整条分支失败
+    while (current >= 0 && current != join) {
+        const FlowchartNode &node = graph.node(current);
+        if (!node.branches.isEmpty()) {
+            ErrorCodeStruct ret = performFlowchartBranches(graph, current);
+            if (ret.code != ErrorCode::OK)
+                return ret;
+            current = node.join;
+            continue;
+        }
+        qInfo("Perform Test in thread : %s",node.name.toStdString().c_str());
+        ErrorCodeStruct ret = performBranchTest(node.type, node.properties["params"]);
+        if (ret.code != ErrorCode::OK)
+            return ret;
+        current = node.success;
     }
-    if (ret.code == ErrorCode::OK)
-        return true;
-    else
-        return false;
+    return ErrorCodeStruct {ErrorCode::OK, ""};
 }
 
-ErrorCodeStruct AACoreNew::performParallelTest(vector<QString> testList1, vector<QString> testList2, QJsonValue prop1, QJsonValue prop2)
+ErrorCodeStruct AACoreNew::performParallelItems(const FlowchartGraph &graph, const QVector<int> &group)
 {
-    QJsonValue params1 = prop1["params"];
-    QJsonValue params2 = prop2["params"];
-    QFuture<bool> f1;
-    QFuture<bool> f2;
-    f1 = QtConcurrent::run(performThreadTest, testList1, params1);
-    f2 = QtConcurrent::run(performThreadTest, testList2, params2);
-    f1.waitForFinished();
-    f2.waitForFinished();
-    qInfo("Finish parallel test");
-    bool ret1 = f1.result();
-    bool ret2 = f2.result();
-    bool ret = (ret1 && ret2);
-    if (ret) {
-        return ErrorCodeStruct {ErrorCode::OK, ""};
-    } else {
-        return ErrorCodeStruct {ErrorCode::GENERIC_ERROR, ""};
+    //按流程顺序逐项启动, 与前面未完成项目资源冲突的等待; 一项失败后不再启动新的项目
+    QElapsedTimer timer; timer.start();
+    int count = group.size();
+    QVector<QFuture<ErrorCodeStruct>> futures(count);
+    QVector<qint64> item_times(count, 0);
+    QVector<int> item_states(count, 0);     //0未开始 1执行中 2完成 3跳过
+    QVector<bool> item_finished(count, false);
+    QVector<ErrorCodeStruct> item_results(count, ErrorCodeStruct {ErrorCode::OK, ""});
+    QMutex item_mutex;
+    QWaitCondition item_finish;
+    bool failed = false;
+    int done = 0;
+    QMutexLocker locker(&item_mutex);
+    while (done < count) {
+        bool progress = false;
+        for (int i = 0; i < count; ++i) {
+            const FlowchartNode &node = graph.node(group[i]);
+            if (item_states[i] == 1 && item_finished[i]) {
+                item_states[i] = 2;
+                done++;
+                progress = true;
+                if (item_results[i].code != ErrorCode::OK)
+                    failed = true;
+            }
+            if (item_states[i] != 0)
+                continue;
+            if (failed) {
+                item_states[i] = 3;
+                done++;
+                progress = true;
+                continue;
+            }
+            //不可撤销的项目(OTP、固化、画胶)等前面所有项目成功后才开始, 与顺序执行一致
+            bool ready = true;
+            for (int j = 0; j < i && ready; ++j) {
+                if (item_states[j] < 2 && (node.barrier || FlowchartGraph::isConflict(graph.node(group[j]), node)))
+                    ready = false;
+            }
+            if (!ready)
+                continue;
+            qInfo("Do Test:%s",node.name.toStdString().c_str());
+            //报警等待在调用线程中进行
+            locker.unlock();
+            checkGlueLevel();
+            locker.relock();
+            qint64 *item_time = &item_times[i];
+            qint32 trace_unit = CycleTraceRecorder::instance()->currentUnit();
+            futures[i] = QtConcurrent::run([this, &node, item_time, i, trace_unit, &item_mutex, &item_finish, &item_finished, &item_results]() {
+                TraceUnitScope unit_scope(trace_unit);
+                QElapsedTimer item_timer; item_timer.start();
+                ErrorCodeStruct ret = performTest(node.type, node.name, node.properties, false);
+                *item_time = item_timer.elapsed();
+                QMutexLocker item_locker(&item_mutex);
+                item_results[i] = ret;
+                item_finished[i] = true;
+                item_finish.wakeAll();
+                return ret;
+            });
+            item_states[i] = 1;
+            progress = true;
+        }
+        //有项目完成时再检查
+        if (!progress)
+            item_finish.wait(&item_mutex);
+    }
+    locker.unlock();
+    for (int i = 0; i < count; ++i) {
+        if (item_states[i] == 2)
+            futures[i].waitForFinished();
+    }
+    //按流程顺序取第一个失败的结果, 与顺序执行时一致
+    ErrorCodeStruct ret = ErrorCodeStruct {ErrorCode::OK, ""};
+    qint64 serial_time = 0;
+    for (int i = 0; i < count; ++i) {
+        serial_time += item_times[i];
+        if (ret.code == ErrorCode::OK && item_states[i] == 2 && item_results[i].code != ErrorCode::OK)
+            ret = item_results[i];
     }
+    qInfo("parallel items %d time %lld ms serial %lld ms",count,timer.elapsed(),serial_time);
+    return ret;
+}
+
+ErrorCodeStruct AACoreNew::performFlowchartBranches(const FlowchartGraph &graph, int fork)
+{
+    const FlowchartNode &node = graph.node(fork);
+    QList<QFuture<ErrorCodeStruct>> futures;
+    qint32 trace_unit = CycleTraceRecorder::instance()->currentUnit();
+    foreach (int branch, node.branches)
+        futures.append(QtConcurrent::run([this, &graph, branch, &node, trace_unit]() {
+            TraceUnitScope unit_scope(trace_unit);
+            return performFlowchartBranch(graph, branch, node.join);
+        }));
+    ErrorCodeStruct ret = ErrorCodeStruct {ErrorCode::OK, ""};
+    for (int i = 0; i < futures.size(); ++i) {
+        futures[i].waitForFinished();
+        if (ret.code == ErrorCode::OK && futures[i].result().code != ErrorCode::OK)
+            ret = futures[i].result();
+    }
+    qInfo("Finish parallel test");
+    return ret;
 }
 
 ErrorCodeStruct AACoreNew::performParticalCheck(QJsonValue params)
@@ -1120,7 +1198,7 @@ ErrorCodeStruct AACoreNew::performParticalCheck(QJsonValue params)
             .append("_")
             .append(getCurrentTimeString())
             .append(".jpg");
-    cv::imwrite(imageName.toStdString().c_str(), inputImage);
+    saveImageInBackground(imageName, inputImage);
 
     return ErrorCodeStruct {ErrorCode::OK, ""};
 }
@@ -1330,7 +1408,7 @@ ErrorCodeStruct AACoreNew::performAA(QJsonValue params)
             step_move_timer.start();
             sut->moveToZPos(start+(i*step_size));
             zScanStopPosition = start+(i*step_size);
-            QThread::msleep(zSleepInMs);
+            sut->carrier->motor_z->WaitSettled(int(zSleepInMs));
             step_move_time += step_move_timer.elapsed();
             double realZ = sut->carrier->GetFeedBackPos().Z;
             qInfo("Z scan start from %f, real: %f", start+(i*step_size), realZ);
@@ -1361,7 +1439,7 @@ ErrorCodeStruct AACoreNew::performAA(QJsonValue params)
                         .append("_")
                         .append(getCurrentTimeString())
                         .append(".bmp");
-                cv::imwrite(imageName.toStdString().c_str(), img);
+                saveImageInBackground(imageName, img);
             }
             double dfov = calculateDFOV(img);
             if(current_dfov.contains(QString::number(i)))
@@ -1384,7 +1462,7 @@ ErrorCodeStruct AACoreNew::performAA(QJsonValue params)
         oc_fov = -1; // temporary disable
         if (oc_fov < 0) {
             sut->moveToZPos(start);
-            QThread::msleep(zSleepInMs);
+            sut->carrier->motor_z->WaitSettled(int(zSleepInMs));
             step_move_time += step_move_timer.elapsed();
             grab_timer.start();
             cv::Mat img = dk->DothinkeyGrabImageCV(0, grabRet);
@@ -1431,7 +1509,7 @@ ErrorCodeStruct AACoreNew::performAA(QJsonValue params)
             step_move_timer.start();
             sut->moveToZPos(target_z+(i*step_size));
             zScanStopPosition = start+(i*step_size);
-            QThread::msleep(zSleepInMs);
+            sut->carrier->motor_z->WaitSettled(int(zSleepInMs));
             step_move_time += step_move_timer.elapsed();
             qInfo("Current Z: %f", sut->carrier->GetFeedBackPos().Z);
             grab_timer.start();
@@ -1458,7 +1536,7 @@ ErrorCodeStruct AACoreNew::performAA(QJsonValue params)
                         .append("_")
                         .append(getCurrentTimeString())
                         .append(".bmp");
-                cv::imwrite(imageName.toStdString().c_str(), img);
+                saveImageInBackground(imageName, img);
             }
 
             double realZ = sut->carrier->GetFeedBackPos().Z;
@@ -1507,7 +1585,7 @@ ErrorCodeStruct AACoreNew::performAA(QJsonValue params)
             step_move_timer.start();
             sut->moveToZPos(target_z+(i*step_size));
             zScanStopPosition = start+(i*step_size);
-            QThread::msleep(zSleepInMs);
+            sut->carrier->motor_z->WaitSettled(int(zSleepInMs));
             step_move_time += step_move_timer.elapsed();
             grab_timer.start();
             cv::Mat img = dk->DothinkeyGrabImageCV(0,grabRet);
@@ -1518,7 +1596,7 @@ ErrorCodeStruct AACoreNew::performAA(QJsonValue params)
                         .append("_")
                         .append(getCurrentTimeString())
                         .append(".bmp");
-                cv::imwrite(imageName.toStdString().c_str(), img);
+                saveImageInBackground(imageName, img);
             }
             grab_time += grab_timer.elapsed();
             if (!grabRet) {
@@ -1574,7 +1652,7 @@ ErrorCodeStruct AACoreNew::performAA(QJsonValue params)
             step_move_timer.start();
             sut->moveToXPos(start+(i*step_size));
             zScanStopPosition = start+(i*step_size);
-            QThread::msleep(zSleepInMs);
+            sut->carrier->motor_x->WaitSettled(int(zSleepInMs));
             step_move_time += step_move_timer.elapsed();
             double realX = sut->carrier->GetFeedBackPos().X;
             qInfo("X scan start from %f, real: %f", start+(i*step_size), realX);
@@ -1602,7 +1680,7 @@ ErrorCodeStruct AACoreNew::performAA(QJsonValue params)
                         .append("_")
                         .append(getCurrentTimeString())
                         .append(".bmp");
-                cv::imwrite(imageName.toStdString().c_str(), img);
+                saveImageInBackground(imageName, img);
             }
             double dfov = calculateDFOV(img);
             if(current_dfov.contains(QString::number(i)))
@@ -1887,7 +1965,7 @@ ErrorCodeStruct AACoreNew::performAA(QJsonValue params)
             return ErrorCodeStruct{ErrorCode::GENERIC_ERROR, map["Result"].toString()};
         }
 
-        QThread::msleep(zSleepInMs);
+        sut->carrier->motor_z->WaitSettled(int(zSleepInMs));
         cv::Mat img = dk->DothinkeyGrabImageCV(0, grabRet);
         double beforeZ = sut->carrier->GetFeedBackPos().Z;
         double expected_fov = fov_slope*z_peak + fov_intercept;
@@ -2680,7 +2758,7 @@ QVariantMap AACoreNew::sfrFitCurve_Advance(int resize_factor, double start_pos)
     map.insert("fov_slope", current_fov_slope);
     //emit pushDataToUnit(runningUnit, "SFR", map);
     emit postSfrDataToELK(runningUnit, map);
-    data->plot(runningTestName);
+    data->plot(currentTestName());
     return result;
 }
 
@@ -2902,7 +2980,7 @@ ErrorCodeStruct AACoreNew::performMTFNew(QJsonValue params, bool write_log)
                 .append("_")
                 .append(getCurrentTimeString())
                 .append(".jpg");
-        cv::imwrite(imageName.toStdString().c_str(), input_img);
+        saveImageInBackground(imageName, input_img);
         error.append("Error in calculating fov");
         map.insert("Result", error);
         emit pushDataToUnit(runningUnit, "MTF", map);
@@ -2967,19 +3045,16 @@ ErrorCodeStruct AACoreNew::performMTFNew(QJsonValue params, bool write_log)
         }
         input_img(roi).copyTo(cropped_b_img);
 
-        QFuture<double> f1, f2, f3, f4;
-        f1 = QtConcurrent::run(performMTFInThread, cropped_l_img, this->parameters.mtfFrequency() + 1);
-        f2 = QtConcurrent::run(performMTFInThread, cropped_r_img, this->parameters.mtfFrequency() + 1);
-        f3 = QtConcurrent::run(performMTFInThread, cropped_t_img, this->parameters.mtfFrequency() + 1);
-        f4 = QtConcurrent::run(performMTFInThread, cropped_b_img, this->parameters.mtfFrequency() + 1);
-        f1.waitForFinished();
-        f2.waitForFinished();
-        f3.waitForFinished();
-        f4.waitForFinished();
-        double sfr_l = f1.result();
-        double sfr_r = f2.result();
-        double sfr_t = f3.result();
-        double sfr_b = f4.result();
+        int freq = this->parameters.mtfFrequency() + 1;
+        std::future<double> f1, f2, f3, f4;
+        f1 = ComputePool::instance()->submit([cropped_l_img, freq]() { return performMTFInThread(cropped_l_img, freq); }, ComputePool::Critical);
+        f2 = ComputePool::instance()->submit([cropped_r_img, freq]() { return performMTFInThread(cropped_r_img, freq); }, ComputePool::Critical);
+        f3 = ComputePool::instance()->submit([cropped_t_img, freq]() { return performMTFInThread(cropped_t_img, freq); }, ComputePool::Critical);
+        f4 = ComputePool::instance()->submit([cropped_b_img, freq]() { return performMTFInThread(cropped_b_img, freq); }, ComputePool::Critical);
+        double sfr_l = f1.get();
+        double sfr_r = f2.get();
+        double sfr_t = f3.get();
+        double sfr_b = f4.get();
         sfr_l_v.push_back(sfr_l);
         sfr_r_v.push_back(sfr_r);
         sfr_t_v.push_back(sfr_t);
@@ -10,10 +10,12 @@
 #include <unordered_map>
 #include <QObject>
 #include <QJsonDocument>
+#include <QSharedPointer>
 #include <utils/errorcode.h>
 #include <QMap>
 #include "AACore/sfrworker.h"
 #include "AACore/aadata.h"
+#include "AACore/flowchartgraph.h"
 #include "aaHeadModule/aaheadmodule.h"
 #include "lutModule/lut_module.h"
 #include "sutModule/sut_module.h"
@@ -87,17 +89,22 @@ public:
     ErrorCodeStruct performGRR(bool change_lens,bool change_sensor,int repeat_time,int change_time);
     ErrorCodeStruct performYLevelTest(QJsonValue params);
     ErrorCodeStruct performOTP(QJsonValue params);
-    ErrorCodeStruct performParallelTest(vector<QString> testList1, vector<QString> testList2, QJsonValue params1, QJsonValue params2);
+    ErrorCodeStruct performFlowchartBranches(const FlowchartGraph &graph, int fork);
+    ErrorCodeStruct performParallelItems(const FlowchartGraph &graph, const QVector<int> &group);
+    ErrorCodeStruct performFlowchartBranch(const FlowchartGraph &graph, int current, int join);
     ErrorCodeStruct performParticalCheck(QJsonValue params);
 
-    static bool performThreadTest(vector<QString> testList, QJsonValue params);
+    ErrorCodeStruct performBranchTest(int type, QJsonValue params);
     static double performMTFInThread( cv::Mat input, int freq);
     bool blackScreenCheck(cv::Mat inImage);
     void performMTFLoopTest();
     double calculateDFOV(cv::Mat img);
     void setSfrWorkerController(SfrWorkerController*);
     bool runFlowchartTest();
-    ErrorCodeStruct performTest(QString testItemName, QJsonValue properties);
+    ErrorCodeStruct performTest(int type, QString testItemName, QJsonValue properties, bool pre_check = true);
+    void checkGlueLevel();
+    void setRunningTest(const QString &test_name, const QString &running_text);
+    QString currentTestName();
     ErrorCodeStruct performDispense(QJsonValue params);
     void loadJsonConfig(QString file_name);
     void saveJsonConfig(QString file_name);
@@ -119,6 +126,9 @@ private:
     bool is_run = false;
     bool hasDispense = false;
     QMutex lut_mutex;
+    QMutex flowchart_mutex;
+    QSharedPointer<const FlowchartGraph> flowchart_graph;  //编译后不再修改, 更新流程图时只替换指针
+    QSharedPointer<const FlowchartGraph> currentFlowchartGraph();
     void run(bool has_material);
     void LogicNg(int & ng_time);
     void NgLens();
@@ -174,6 +184,7 @@ private:
     double mtf_oc_y = 0;
     int current_dispense = 0;
     QString runningTestName = "";
+    QMutex test_state_mutex;    //并行项目在线程池中执行, 保护当前测试名
     QVariantMap sfrFitCurve_Advance(int resize_factor, double start_pos);
     std::vector<AA_Helper::patternAttr> search_mtf_pattern(cv::Mat inImage, QImage & image, bool isFastMode,
                                                                unsigned int & ccROIIndex,
@@ -211,8 +222,11 @@ public slots:
     void storeSfrResults(unsigned int index, vector<Sfr_entry> sfrs, int timeElasped);
     void stopZScan();
     void setFlowchartDocument(QString json){
+        //运行中的单元持有旧图的指针, 不受影响
+        QMutexLocker locker(&flowchart_mutex);
         this->flowchartJsonString = json;
         flowchartDocument = QJsonDocument::fromJson(json.toUtf8());
+        flowchart_graph.reset();
     }
     void sfrImageReady(QImage);
     void aaCoreParametersChanged();
@@ -139,6 +139,8 @@ class AACoreParameters : public PropertyBase
 
     QString m_vcmRegAddress = "0x03";
 
+    bool m_parallelTestItems = false;
+
 public:
     explicit AACoreParameters(){
         for (int i = 0; i < 4*5; i++) // 4 field of view * 4 edge number
@@ -211,6 +213,7 @@ public:
     Q_PROPERTY(int vcmInitMode READ vcmInitMode WRITE setVCMInitMode NOTIFY vcmInitModeChanged)
     Q_PROPERTY(QString vcmSlaveId READ vcmSlaveId WRITE setVCMSlaveId NOTIFY vcmSlaveIdChanged)
     Q_PROPERTY(QString vcmRegAddress READ vcmRegAddress WRITE setVCMRegAddress NOTIFY vcmRegAddressChanged)
+    Q_PROPERTY(bool parallelTestItems READ parallelTestItems WRITE setParallelTestItems NOTIFY parallelTestItemsChanged)
 
     double EFL() const
     {
@@ -541,6 +544,11 @@ public:
         return m_vcmRegAddress;
     }
 
+    bool parallelTestItems() const
+    {
+        return m_parallelTestItems;
+    }
+
 public slots:
     void setEFL(double EFL)
     {
@@ -1119,6 +1127,15 @@ public slots:
         emit vcmRegAddressChanged(m_vcmRegAddress);
     }
 
+    void setParallelTestItems(bool parallelTestItems)
+    {
+        if (m_parallelTestItems == parallelTestItems)
+            return;
+
+        m_parallelTestItems = parallelTestItems;
+        emit parallelTestItemsChanged(m_parallelTestItems);
+    }
+
 signals:
     void paramsChanged();
     void firstRejectSensorChanged(bool firstRejectSensor);
@@ -1175,6 +1192,7 @@ signals:
     void vcmInitModeChanged(int vcmInitMode);
     void vcmSlaveIdChanged(QString vcmSlaveId);
     void vcmRegAddressChanged(QString vcmRegAddress);
+    void parallelTestItemsChanged(bool parallelTestItems);
 };
 class AACoreStates: public PropertyBase
 {
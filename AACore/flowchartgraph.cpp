@@ -0,0 +1,235 @@
+#include "AACore/flowchartgraph.h"
+#include "config.h"
+#include <QMap>
+
+int FlowchartGraph::operatorType(const QString &name)
+{
+    //与原来按名字判断的先后顺序一致
+    if (name.contains(AA_PIECE_START)) return Start;
+    if (name.contains(AA_PIECE_LOAD_CAMERA)) return LoadCamera;
+    if (name.contains(AA_PIECE_INIT_LENS)) return InitLens;
+    if (name.contains(AA_PIECE_INIT_CAMERA)) return InitCamera;
+    if (name.contains(AA_PIECE_PR_TO_BOND)) return PrToBond;
+    if (name.contains(AA_PIECE_INITIAL_TILT)) return InitialTilt;
+    if (name.contains(AA_PIECE_Z_OFFSET)) return ZOffset;
+    if (name.contains(AA_PIECE_XY_OFFSET)) return XYOffset;
+    if (name.contains(AA_PIECE_LOAD_MATERIAL)) return LoadMaterial;
+    if (name.contains(AA_PIECE_UNLOAD_LENS)) return UnloadLens;
+    if (name.contains(AA_UNLOAD_CAMERA)) return UnloadCamera;
+    if (name.contains(AA_PIECE_OC)) return OC;
+    if (name.contains(AA_PIECE_Y_LEVEL)) return YLevel;
+    if (name.contains(AA_PIECE_AA)) return AA;
+    if (name.contains(AA_PIECE_MTF)) return MTF;
+    if (name.contains(AA_PIECE_UV)) return UV;
+    if (name.contains(AA_PIECE_OTP)) return OTP;
+    if (name.contains(AA_PIECE_DISPENSE)) return Dispense;
+    if (name.contains(AA_PIECE_DELAY)) return Delay;
+    if (name.contains(AA_PIECE_ACCEPT)) return Accept;
+    if (name.contains(AA_PIECE_REJECT)) return Reject;
+    if (name.contains(AA_PIECE_TERMINATE)) return Terminate;
+    if (name.contains(AA_PIECE_GRR)) return GRR;
+    if (name.contains(AA_PIECE_JOIN)) return Join;
+    if (name.contains(AA_PIECE_SAVE_IMAGE)) return SaveImage;
+    if (name.contains(AA_PIECE_PARTICAL_CHECK)) return ParticalCheck;
+    return Unknown;
+}
+
+bool FlowchartGraph::operatorResources(int type, const QJsonValue &properties, int &reads, int &writes)
+{
+    reads = 0;
+    writes = 0;
+    //固化、对位等改变镜头位置的项目写LensResource, 之后的测量都要等它完成
+    switch (type) {
+    case InitCamera:
+        writes = SensorResource|I2CResource;
+        return true;
+    case PrToBond:
+        writes = SutResource|AAHeadResource|LensResource;
+        return true;
+    case OC:
+    case AA:
+        reads = SensorResource;
+        writes = ImageResource|SutResource|AAHeadResource|LensResource;
+        return true;
+    case YLevel:
+    case MTF:
+        reads = SensorResource|LensResource;
+        writes = ImageResource;
+        return true;
+    case OTP:
+        reads = SensorResource|LensResource;
+        writes = I2CResource;
+        return true;
+    case UV:
+    {
+        //固化中可选的OTP和Y Level检查会操作sensor
+        QJsonValue params = properties["params"];
+        writes = UVResource|LensResource;
+        if (params["enable_OTP"].toInt(0)) {
+            reads |= SensorResource;
+            writes |= I2CResource;
+        }
+        if (params["enable_y_level_check"].toInt(0)) {
+            reads |= SensorResource;
+            writes |= ImageResource;
+        }
+        return true;
+    }
+    case Dispense:
+        writes = SutResource|DispenserResource|LensResource;
+        return true;
+    default:
+        //延时等其他项目依赖前后顺序, 不参与并行
+        return false;
+    }
+}
+
+bool FlowchartGraph::isIrreversible(int type)
+{
+    //烧录、固化、画胶后无法恢复, 不能在前面的测试结果出来前开始
+    return type == OTP||type == UV||type == Dispense;
+}
+
+bool FlowchartGraph::isConflict(const FlowchartNode &first, const FlowchartNode &second)
+{
+    return (first.writes&(second.reads|second.writes)) != 0||(second.writes&first.reads) != 0;
+}
+
+void FlowchartGraph::clear()
+{
+    nodes.clear();
+    node_indexs.clear();
+    start = -1;
+    link_count = 0;
+    compiled = false;
+    grouped = false;
+}
+
+int FlowchartGraph::addNode(const QString &name, const QJsonObject &operators)
+{
+    int index = node_indexs.value(name,-1);
+    if(index >= 0)
+        return index;
+    FlowchartNode node;
+    node.name = name;
+    node.type = operatorType(name);
+    node.properties = operators.value(name).toObject().value("properties");
+    node.terminal = name.contains("Accept")||name.contains("Reject")||name.contains("Terminate");
+    index = nodes.size();
+    nodes.append(node);
+    node_indexs.insert(name,index);
+    return index;
+}
+
+bool FlowchartGraph::compile(const QJsonObject &flowchart, QString &error, bool group_items)
+{
+    clear();
+    QJsonObject links = flowchart.value("links").toObject();
+    QJsonObject operators = flowchart.value("operators").toObject();
+    foreach (const QString &key, operators.keys())
+        addNode(key,operators);
+    //同一出口有多条连线时取第一条, 与原来按key顺序查找一致
+    QVector<QMap<QString,int>> branch_edges(nodes.size());
+    foreach (const QString &key, links.keys()) {
+        QJsonObject link = links.value(key).toObject();
+        int from = addNode(link.value("fromOperator").toString(),operators);
+        int to = addNode(link.value("toOperator").toString(),operators);
+        QString connector = link.value("fromConnector").toString();
+        branch_edges.resize(nodes.size());
+        if(connector == "success")
+        {
+            if(nodes[from].success < 0)
+                nodes[from].success = to;
+        }
+        else if(connector == "fail")
+        {
+            if(nodes[from].fail < 0)
+                nodes[from].fail = to;
+        }
+        else if(connector.startsWith("thread_"))
+            branch_edges[from].insert(connector,to);
+        link_count++;
+    }
+    for (int i = 0; i < nodes.size(); ++i)
+        nodes[i].branches = branch_edges[i].values().toVector();
+    start = node_indexs.value("start",-1);
+    if(start < 0)
+    {
+        error = "flowchart has no start operator";
+        return false;
+    }
+    for (int i = 0; i < nodes.size(); ++i) {
+        if(!nodes[i].branches.isEmpty()&&resolveFork(i,0,error) < 0)
+            return false;
+    }
+    if(group_items)
+    {
+        //只有成功出口的项目才能提前开始, 失败时整组按原来一样拒绝
+        QVector<bool> groupable(nodes.size());
+        for (int i = 0; i < nodes.size(); ++i) {
+            FlowchartNode &node = nodes[i];
+            node.barrier = isIrreversible(node.type);
+            groupable[i] = operatorResources(node.type,node.properties,node.reads,node.writes)&&node.branches.isEmpty()
+                    &&node.fail < 0&&node.success >= 0&&(!node.terminal);
+        }
+        for (int i = 0; i < nodes.size(); ++i) {
+            QVector<int> group;
+            for (int current = i; current >= 0&&groupable[current]&&(!group.contains(current)); current = nodes[current].success)
+                group.append(current);
+            if(group.size() > 1)
+                nodes[i].group = group;
+        }
+    }
+    grouped = group_items;
+    compiled = true;
+    return true;
+}
+
+int FlowchartGraph::resolveFork(int fork, int depth, QString &error)
+{
+    if(nodes[fork].join >= 0)
+        return nodes[fork].join;
+    if(depth > nodes.size())
+    {
+        error = QString("flowchart branches of %1 form a loop").arg(nodes[fork].name);
+        return -1;
+    }
+    int join = -1;
+    foreach (int branch, nodes[fork].branches) {
+        int branch_join = findJoin(branch,depth + 1,error);
+        if(branch_join < 0)
+            return -1;
+        if(join >= 0&&branch_join != join)
+        {
+            error = QString("branches of %1 end at different joins %2 and %3").arg(nodes[fork].name).arg(nodes[join].name).arg(nodes[branch_join].name);
+            return -1;
+        }
+        join = branch_join;
+    }
+    nodes[fork].join = join;
+    return join;
+}
+
+int FlowchartGraph::findJoin(int branch, int depth, QString &error)
+{
+    int current = branch;
+    for (int step = 0; step <= nodes.size(); ++step) {
+        if(current < 0)
+            break;
+        const FlowchartNode &node = nodes[current];
+        if(node.type == Join)
+            return current;
+        if(!node.branches.isEmpty())
+        {
+            //嵌套分支从其Join之后继续
+            int nested_join = resolveFork(current,depth + 1,error);
+            if(nested_join < 0)
+                return -1;
+            current = nodes[nested_join].success;
+        }
+        else
+            current = node.success;
+    }
+    error = QString("branch starting at %1 does not reach a join").arg(nodes[branch].name);
+    return -1;
+}
@@ -0,0 +1,126 @@
+#ifndef FLOWCHARTGRAPH_H
+#define FLOWCHARTGRAPH_H
+
+#include <QHash>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QString>
+#include <QVector>
+
+/*
+ * AA flowchart compiled once into an indexed graph. Each operator becomes a
+ * node with its test type resolved from the operator name, and its success
+ * edge, fail edge and thread_N branch edges resolved to node indexes, so
+ * running a unit never searches the links again. A node with branch edges
+ * forks; every branch follows its success edges to the same Join node,
+ * which is found at compile time. Nested forks inside a branch are allowed.
+ * When grouping is enabled, each item also gets the run of items that
+ * follow it along success edges and have no fail edge; the executor may
+ * overlap items in that group whose declared resources do not conflict.
+ */
+struct FlowchartNode
+{
+    QString name;
+    int type = 0;
+    QJsonValue properties;
+    int success = -1;
+    int fail = -1;
+    QVector<int> branches;
+    int join = -1;          //分支汇合的Join节点
+    bool terminal = false;  //Accept/Reject/Terminate
+    QVector<int> group;     //从此节点起可按资源并行的连续节点
+    int reads = 0;
+    int writes = 0;
+    bool barrier = false;   //不可撤销, 只在前面的项目都成功后开始
+};
+
+class FlowchartGraph
+{
+public:
+    enum OperatorType
+    {
+        Unknown = 0,
+        Start,
+        LoadCamera,
+        InitLens,
+        InitCamera,
+        PrToBond,
+        InitialTilt,
+        ZOffset,
+        XYOffset,
+        LoadMaterial,
+        UnloadLens,
+        UnloadCamera,
+        OC,
+        YLevel,
+        AA,
+        MTF,
+        UV,
+        OTP,
+        Dispense,
+        Delay,
+        Accept,
+        Reject,
+        Terminate,
+        GRR,
+        Join,
+        SaveImage,
+        ParticalCheck
+    };
+    enum Resource
+    {
+        SensorResource = 0x01,      //sensor上电状态
+        ImageResource = 0x02,       //取图
+        I2CResource = 0x04,
+        UVResource = 0x08,
+        SutResource = 0x10,
+        AAHeadResource = 0x20,
+        DispenserResource = 0x40,
+        LensResource = 0x80         //镜头与sensor的相对位置
+    };
+    static int operatorType(const QString &name);
+    static bool operatorResources(int type, const QJsonValue &properties, int &reads, int &writes);
+    static bool isIrreversible(int type);
+    static bool isConflict(const FlowchartNode &first, const FlowchartNode &second);
+
+    bool compile(const QJsonObject &flowchart, QString &error, bool group_items = false);
+    bool isGrouped() const
+    {
+        return grouped;
+    }
+    bool isCompiled() const
+    {
+        return compiled;
+    }
+    void clear();
+    int startNode() const
+    {
+        return start;
+    }
+    int linkCount() const
+    {
+        return link_count;
+    }
+    int nodeCount() const
+    {
+        return nodes.size();
+    }
+    const FlowchartNode &node(int index) const
+    {
+        return nodes[index];
+    }
+
+private:
+    int addNode(const QString &name, const QJsonObject &operators);
+    int resolveFork(int fork, int depth, QString &error);
+    int findJoin(int branch, int depth, QString &error);
+
+    QVector<FlowchartNode> nodes;
+    QHash<QString,int> node_indexs;
+    int start = -1;
+    int link_count = 0;
+    bool compiled = false;
+    bool grouped = false;
+};
+
+#endif // FLOWCHARTGRAPH_H
@@ -0,0 +1,98 @@
+#include "lightcommandqueue.h"
+#include <QElapsedTimer>
+
+LightCommandQueue::LightCommandQueue()
+{
+}
+
+LightCommandQueue::~LightCommandQueue()
+{
+    stopThd();
+}
+
+void LightCommandQueue::setWriter(Writer writer)
+{
+    QMutexLocker tmpLocker(&queueLocker);
+    this->writer = writer;
+}
+
+void LightCommandQueue::startThd()
+{
+    if(isRunning())
+        return;
+    isRun = true;
+    this->start();
+}
+
+void LightCommandQueue::stopThd()
+{
+    if(!isRunning())
+        return;
+    queueLocker.lock();
+    isRun = false;
+    queueChanged.wakeAll();
+    queueLocker.unlock();
+    this->wait();
+    qInfo("LightCommandQueue written %d coalesced %d",writtenCommandCount,coalescedCommandCount);
+}
+
+void LightCommandQueue::post(int channel, int value)
+{
+    QMutexLocker tmpLocker(&queueLocker);
+    if(pendingCommands.contains(channel))
+        coalescedCommandCount++;
+    pendingCommands[channel] = value;
+    queueChanged.wakeAll();
+}
+
+bool LightCommandQueue::isPending(int channel)
+{
+    QMutexLocker tmpLocker(&queueLocker);
+    return pendingCommands.contains(channel);
+}
+
+bool LightCommandQueue::waitChannel(int channel, int timeout)
+{
+    QElapsedTimer timer; timer.start();
+    QMutexLocker tmpLocker(&queueLocker);
+    while (pendingCommands.contains(channel) || writingChannel == channel) {
+        qint64 left = timeout - timer.elapsed();
+        if(left <= 0 || !isRunning())
+        {
+            qWarning("LightCommandQueue wait channel %d timeout", channel);
+            return false;
+        }
+        commandWritten.wait(&queueLocker, ulong(left));
+    }
+    return true;
+}
+
+void LightCommandQueue::run()
+{
+    QMutexLocker tmpLocker(&queueLocker);
+    while (isRun) {
+        if(pendingCommands.isEmpty())
+        {
+            queueChanged.wait(&queueLocker);
+            continue;
+        }
+        int channel = pendingCommands.firstKey();
+        int value = pendingCommands.take(channel);
+        writingChannel = channel;
+        Writer currentWriter = writer;
+        tmpLocker.unlock();
+
+        bool result = false;
+        for (ulong i = 0; i < WRITE_RETRY_TIMES && !result; i++)
+            result = currentWriter ? currentWriter(channel, value) : false;
+        if(!result)
+            qWarning("LightCommandQueue write channel %d value %d fail", channel, value);
+
+        tmpLocker.relock();
+        writtenCommandCount++;
+        writingChannel = -1;
+        commandWritten.wakeAll();
+    }
+    writingChannel = -1;
+    commandWritten.wakeAll();
+}
@@ -0,0 +1,52 @@
+#ifndef LIGHTCOMMANDQUEUE_H
+#define LIGHTCOMMANDQUEUE_H
+
+#include <QThread>
+#include <QMap>
+#include <QMutex>
+#include <QWaitCondition>
+#include <functional>
+
+/*
+ * Serial command queue shared by the light controller drivers.
+ * Callers post channel values without waiting for the serial round trip,
+ * a newer value for a channel replaces the one still waiting in the queue,
+ * and the worker thread writes the remaining values through the driver.
+ * A synchronous caller only waits for the values queued on its own channel.
+ * The written and coalesced counts are logged when the queue stops.
+ */
+class LightCommandQueue:public QThread
+{
+    Q_OBJECT
+
+public:
+    typedef std::function<bool(int channel, int value)> Writer;
+
+    explicit LightCommandQueue();
+    ~LightCommandQueue() override;
+
+    void setWriter(Writer writer);
+    void startThd();
+    void stopThd();
+
+    void post(int channel, int value);
+    bool isPending(int channel);
+    bool waitChannel(int channel, int timeout = 1000);
+
+protected:
+    void run() override;
+
+private:
+    const ulong WRITE_RETRY_TIMES = 2;
+    bool isRun = false;
+    int writingChannel = -1;
+    int writtenCommandCount = 0;
+    int coalescedCommandCount = 0;
+    Writer writer;
+    QMap<int, int> pendingCommands;
+    QMutex queueLocker;
+    QWaitCondition queueChanged;
+    QWaitCondition commandWritten;
+};
+
+#endif // LIGHTCOMMANDQUEUE_H
@@ -5,10 +5,15 @@ SciencaLightSourceController::SciencaLightSourceController():
     isOpen(false), currenChannel(-1)
 {
     loadJsonConfig(configFileName, configSectionName);
+    commandQueue.setWriter([this](int channel, int value) {
+        return writeIntensity(channel, value);
+    });
+    commandQueue.startThd();
 }
 
 SciencaLightSourceController::~SciencaLightSourceController()
 {
+    commandQueue.stopThd();
     close();
 }
 
@@ -19,6 +24,7 @@ void SciencaLightSourceController::open()
         qInfo("Has been opened!");
         return;
     }
+    QMutexLocker locker(&deviceMutex);
     device.setPortName(m_portName);
     device.setBaudRate(9600);
     device.setStopBits(QSerialPort::StopBits::OneStop);
@@ -27,6 +33,7 @@ void SciencaLightSourceController::open()
     {
         qInfo("Open port successful!");
         isOpen = true;
+        locker.unlock();
         setIntensity(WaveLength);
         setIntensity(ColorTemperature);
     }
@@ -37,6 +44,7 @@ void SciencaLightSourceController::open()
 
 void SciencaLightSourceController::close()
 {
+    QMutexLocker locker(&deviceMutex);
     if(isOpen)
     {
         device.close();
@@ -48,6 +56,24 @@ void SciencaLightSourceController::setIntensity(Channel channel)
 {
     if(!isOpen){qCritical() << tr("Did not init!"); return;}
 
+    ushort value = 0;
+    if(channel == ColorTemperature)
+    {
+        value = colorTemperatureIntensity();
+    }
+    else if(channel == WaveLength)
+    {
+        value = waveLengthIntensity();
+    }
+    //每条命令要等两次应答, 放到命令队列里写, 界面调用不等串口
+    commandQueue.post(channel, value);
+}
+
+bool SciencaLightSourceController::writeIntensity(int channel, int value)
+{
+    QMutexLocker locker(&deviceMutex);
+    if(!isOpen){qCritical() << tr("Did not init!"); return false;}
+
     try {
         if(channel != currenChannel)
         {
@@ -56,15 +82,6 @@ void SciencaLightSourceController::setIntensity(Channel channel)
         }
         SLSCCommandStruct cmd;
         cmd.cmd = SetBrightness;
-        ushort value = 0;
-        if(channel == ColorTemperature)
-        {
-            value = colorTemperatureIntensity();
-        }
-        else if(channel == WaveLength)
-        {
-            value = waveLengthIntensity();
-        }
         cmd.data1 = value & 0xff;
         cmd.data2 = (value & 0xff00) >> 8;
         cmd.calculateCheckCode();
@@ -77,17 +94,23 @@ void SciencaLightSourceController::setIntensity(Channel channel)
            rsp.data3 != currenChannel)
         {
             qCritical() << tr("Response error! Cmd: ") << cmd.toString() << "Rsp: " << rsp.toString();
+            return false;
         }
+        return true;
     } catch (std::exception& e) {
         qCritical() << e.what();
+        return false;
     }
-
 }
 
 int SciencaLightSourceController::getIntensity(Channel channel)
 {
     if(!isOpen){qCritical() << tr("Did not init!"); return -1;}
 
+    //先等本通道排队中的亮度写完
+    commandQueue.waitChannel(channel);
+    QMutexLocker locker(&deviceMutex);
+
     try {
         if(channel != currenChannel)
         {
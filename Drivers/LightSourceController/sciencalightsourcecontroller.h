@@ -5,9 +5,11 @@
 #include <QtSerialPort/QSerialPort>
 #include <QtSerialPort/QSerialPortInfo>
 #include <QDebug>
+#include <QMutex>
 #include <QTimer>
 #include <exception>
 #include "propertybase.h"
+#include "lightcommandqueue.h"
 
 enum SLSCCommand{
     SelectChannel = 0x01,
@@ -70,6 +72,7 @@ public:
     Q_INVOKABLE int getIntensity(Channel channel);
 
 private:
+    bool writeIntensity(int channel, int value);
     void selectChannel(int channel);
     void writeCmd(SLSCCommandStruct& cmd);
     SLSCCommandStruct readRsp();
@@ -136,6 +139,9 @@ private:
     bool isOpen;
     int currenChannel;
     QSerialPort device;
+    //串口收发在队列线程和读取亮度的调用线程之间互斥
+    QMutex deviceMutex;
+    LightCommandQueue commandQueue;
     QString m_portName;
     int m_colorTemperatureIntensity;
     int m_waveLengthIntensity;
@@ -27,6 +27,7 @@ TRANSLATIONS = languagePackage/chinese.ts languagePackage/english.ts
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
 SOURCES += \
+    Drivers/LightSourceController/lightcommandqueue.cpp \
     Drivers/LightSourceController/sciencalightsourcecontroller.cpp \
     devicestatesgeter.cpp \
     i2cControl/i2ccontrol.cpp \
@@ -60,14 +61,24 @@ SOURCES += \
     logicmanager.cpp \
     utils/filecontent.cpp \
     basemodulemanager.cpp \
+    contactheightmodel.cpp \
+    cycletracerecorder.cpp \
+    computepool.cpp \
+    uphSimulation/uphsimulator.cpp \
     utils/LontryLight.cpp \
     XtCylinder.cpp \
     XtMotor.cpp \
+    motiontimingrecorder.cpp \
+    motorlimitindex.cpp \
+    xtmotionexecutor.cpp \
+    xtmotionmonitor.cpp \
+    xtstatesnapshot.cpp \
     XtVcMotor.cpp \
     XtVacuum.cpp \
     lutModule/lut_module.cpp \
     sutModule/sut_module.cpp \
     AACore/aadata.cpp \
+    AACore/flowchartgraph.cpp \
     material_carrier.cpp \
     utils/pixel2mech.cpp \
     Matrix/Matrix.cpp \
@@ -77,6 +88,7 @@ SOURCES += \
     imageGrabber/dothinkey.cpp \
     imageGrabber/iniparser.cpp \
     utils/imageprovider.cpp \
+    dispenseModule/dispense_path_planner.cpp \
     dispenseModule/dispenser.cpp \
     dispenseModule/dispense_module.cpp \
     vision/wordoplight.cpp \
@@ -148,8 +160,21 @@ LIBS += -L$$PWD/../libs/sparrow_core/sparrow_core/lib/ -lSparrowCore
 INCLUDEPATH += $$PWD/../libs/sparrow_core/sparrow_core/include
 DEPENDPATH += $$PWD/../libs/sparrow_core/sparrow_core/include
 
-LIBS += -L$$PWD/../libs/motion_x64/ -lMotionControlDll
-LIBS += -L$$PWD/../libs/motion_x64/ -lMotionControlExtendDll
+# qmake CONFIG+=xt_simulation replaces the XT controller dlls with the kinematic simulator
+CONFIG(xt_simulation) {
+    DEFINES += XT_SIMULATION
+    INCLUDEPATH += $$PWD/xtSimulation
+    HEADERS += \
+        xtSimulation/XT_MotionControler_Client_Lib.h \
+        xtSimulation/XT_MotionControlerExtend_Client_Lib.h \
+        xtSimulation/xtsimulator.h
+    SOURCES += \
+        xtSimulation/xt_controler_simulation.cpp \
+        xtSimulation/xtsimulator.cpp
+} else {
+    LIBS += -L$$PWD/../libs/motion_x64/ -lMotionControlDll
+    LIBS += -L$$PWD/../libs/motion_x64/ -lMotionControlExtendDll
+}
 LIBS += -L$$PWD/../libs/motion_x64/ -lvoice_motor_dll
 
 INCLUDEPATH += $$PWD/../libs/motion_x64
@@ -165,6 +190,7 @@ INCLUDEPATH += $$PWD/../libs/UsbI2cIo/libs
 DEPENDPATH += $$PWD/../libs/UsbI2cIo/libs
 
 HEADERS += \
+    Drivers/LightSourceController/lightcommandqueue.h \
     Drivers/LightSourceController/sciencalightsourcecontroller.h \
     UnitTest/SilicolMsgBoxTest.h \
     basicconfig.h \
@@ -210,9 +236,18 @@ HEADERS += \
     logicmanager.h \
     utils/filecontent.h \
     basemodulemanager.h \
+    contactheightmodel.h \
+    cycletracerecorder.h \
+    computepool.h \
+    uphSimulation/uphsimulator.h \
     utils/LontryLight.h \
     XtCylinder.h \
     xtmotor.h \
+    motiontimingrecorder.h \
+    motorlimitindex.h \
+    xtmotionexecutor.h \
+    xtmotionmonitor.h \
+    xtstatesnapshot.h \
     XtVcMotor.h \
     material_carrier.h \
     XtVacuum.h \
@@ -222,6 +257,7 @@ HEADERS += \
     lutModule/lut_parameter.h \
     sutModule/sut_module.h \
     AACore/aadata.h \
+    AACore/flowchartgraph.h \
     utils/pixel2mech.h \
     Matrix/Matrix.h \
     calibration/calibration.h \
@@ -232,6 +268,7 @@ HEADERS += \
     imageGrabber/iniparser.h \
     utils/ \
     XtVacuum.h \
+    dispenseModule/dispense_path_planner.h \
     dispenseModule/dispenser.h \
     dispenseModule/dispenser_parameter.h \
     dispenseModule/dispense_module.h \
@@ -72,6 +72,20 @@ bool XtCylinder::Wait(bool target_state)
         state_fold = false;
         state_unfold = true;
     }
+    //有到位反馈并设置了去抖时间时, 反馈稳定即返回, 不再等到位后的固定延时
+    if(parameters.debounceTime() > 0&&(in_fold != nullptr||in_unfold != nullptr))
+    {
+        int elapsed = 0;
+        if(XtGeneralInput::WaitConfirm([this,state_fold,state_unfold](){
+                                       return (in_fold == nullptr||in_fold->Value() == state_fold)&&(in_unfold == nullptr||in_unfold->Value() == state_unfold);},
+                                       parameters.debounceTime(),parameters.outTime(),&elapsed))
+        {
+            int fixed_time = (elapsed + 9)/10*10 + (target_state?parameters.finishOneDelay():parameters.finishZeroDelay());
+            qInfo("%s confirmed in %d ms, saved %d ms",parameters.cylinderName().toStdString().c_str(),elapsed,fixed_time - elapsed - parameters.debounceTime());
+            return true;
+        }
+        count = 0;
+    }
     while(count>0)
     {
         if ((in_fold == nullptr||in_fold->Value() == state_fold)&&(in_unfold == nullptr||in_unfold->Value() == state_unfold))
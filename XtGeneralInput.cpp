@@ -1,6 +1,7 @@
 #include "XtGeneralInput.h"
 #include "XT_MotionControler_Client_Lib.h"
 #include "XT_MotionControlerExtend_Client_Lib.h"
+#include <QElapsedTimer>
 #include <QThread>
 int XtGeneralInput::count = 0;
 XtGeneralInput::XtGeneralInput(void)
@@ -113,6 +114,43 @@ bool XtGeneralInput::Wait(bool value, int timeout)
     return false;
 }
 
+bool XtGeneralInput::WaitStable(bool value, int debounce, int timeout, int *elapsed)
+{
+    if(input_id<0)
+        return false;
+    return WaitConfirm([this,value](){return Value() == value;},debounce,timeout,elapsed);
+}
+
+bool XtGeneralInput::WaitConfirm(std::function<bool()> confirmed, int debounce, int timeout, int *elapsed)
+{
+    //反馈连续保持debounce毫秒才算到位, elapsed为首次到位的时间
+    QElapsedTimer timer; timer.start();
+    qint64 stable_start = -1;
+    while (true)
+    {
+        qint64 now = timer.elapsed();
+        if(confirmed())
+        {
+            if(stable_start < 0)
+                stable_start = now;
+            if(now - stable_start >= debounce)
+            {
+                if(elapsed != nullptr)
+                    *elapsed = int(stable_start);
+                return true;
+            }
+        }
+        else
+            stable_start = -1;
+        if(now >= timeout)
+            break;
+        QThread::msleep(1);
+    }
+    if(elapsed != nullptr)
+        *elapsed = int(timer.elapsed());
+    return false;
+}
+
 QString XtGeneralInput::Name()
 {
     return name;
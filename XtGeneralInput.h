@@ -5,6 +5,7 @@
 #include <QObject>
 #include <QTime>
 #include <QString>
+#include <functional>
 
 class XtGeneralInput:public ErrorBase
 {
@@ -21,6 +22,8 @@ public:
     bool getValueToReg(int thread);
     bool getRegState(int thread);
     bool Wait(bool value,int timeout);
+    bool WaitStable(bool value,int debounce,int timeout,int *elapsed = nullptr);
+    static bool WaitConfirm(std::function<bool()> confirmed,int debounce,int timeout,int *elapsed = nullptr);
     QString Name();
 private:
     QString name;
@@ -51,6 +51,23 @@ void XtVacuum::SET(int thread, bool new_state)
 bool XtVacuum::Wait(bool target_state)
 {
     if(is_debug)return true;
+    //设置了去抖时间时反馈稳定即返回, 不再等到位后的固定延时
+    if(parameters.debounceTime() > 0&&in_io != nullptr)
+    {
+        int elapsed = 0;
+        bool result = in_io->WaitStable(target_state,parameters.debounceTime(),parameters.outTime(),&elapsed);
+        if((nullptr != break_io)&&(!target_state))
+            break_io->Set(false);
+        if(result)
+        {
+            int fixed_time = (elapsed + 9)/10*10 + parameters.finishDelay();
+            qInfo("%s confirmed in %d ms, saved %d ms",parameters.vacuumName().toStdString().c_str(),elapsed,fixed_time - elapsed - parameters.debounceTime());
+            return true;
+        }
+        AppendError(QString(u8"%1等待%2状态超时，超时时间%3").arg(parameters.vacuumName()).arg(target_state).arg(parameters.outTime()));
+        qInfo(u8"%s等待%d状态超时,超时时间%d.",parameters.vacuumName().toStdString().c_str(),target_state,parameters.outTime());
+        return false;
+    }
     int count = parameters.outTime();
     while(count>0)
     {
@@ -376,6 +376,53 @@ bool XtVcMotor::SearchPosByForce(
     return res;
 }
 
+bool XtVcMotor::SearchPosByForce(const double speed, const double force, const double limit, const double margin,
+                                 ContactHeightModel &model, int tray, int pocket, const int timeout)
+{
+    if (is_debug)
+        return true;
+    QElapsedTimer timer;
+    timer.start();
+    double contact = 0, band = 0;
+    bool learned = model.predict(tray, pocket, contact, band);
+    //预测区间要在原搜索区间内
+    if (learned && (contact - band < limit - margin || contact + band > limit + margin))
+        learned = false;
+    bool fallback = false;
+    bool res = false;
+    double landed = 0;
+    if (learned)
+    {
+        if (!(checkState() && checkLimit(contact + band) && checkInterface(contact + band)))
+            return false;
+        double start_pos = GetOutpuPos();
+        qInfo("%s learned approach tray %d pocket %d contact %f band %f", name.toStdString().c_str(), tray, pocket,
+              contact, band);
+        SetSoftLanding(speed, max_acc, force, start_pos, contact, band);
+        res = DoSoftLanding();
+        res &= WaitSoftLandingDone(timeout);
+        landed = GetFeedbackPos();
+        //走到区间端点说明区间内没有接触
+        if (!res || fabs(landed - contact) >= band * 0.95)
+        {
+            qWarning("%s learned approach outlier tray %d pocket %d contact %f band %f landed %f",
+                     name.toStdString().c_str(), tray, pocket, contact, band, landed);
+            fallback = true;
+            if (!resetSoftLanding(timeout))
+                return false;
+        }
+    }
+    if (!learned || fallback)
+    {
+        res = SearchPosByForce(speed, force, limit, margin, timeout);
+        landed = GetFeedbackPos();
+    }
+    if (res)
+        model.update(tray, pocket, landed);
+    model.recordPick(learned, fallback, timer.elapsed(), landed - contact);
+    return res;
+}
+
 bool XtVcMotor::SearchPosByForce(const double speed, const double force, const int timeout)
 {
     qInfo("start SearchPosByForce");
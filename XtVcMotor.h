@@ -1,6 +1,7 @@
 ﻿#ifndef XTVCMOTOR_H
 #define XTVCMOTOR_H
 #include "VCM_init_Struct.h"
+#include "contactheightmodel.h"
 #include "utils/singletoninstances.h"
 #include "xtmotor.h"
 #include "xtvcmotorparameter.h"
@@ -78,6 +79,9 @@ public:
     bool SearchPosByADC(double vel, double search_limit, double threshold, bool search_above, double &result) override;
     bool SearchPosByForce(const double speed,const double force,const double  limit,const double margin,const int timeout = 30000);
     bool SearchPosByForce(const double speed,const double force,const int timeout = 30000);
+    //按学习到的接触高度快速下到区间前再力控搜索, 超出区间时回退完整搜索
+    bool SearchPosByForce(const double speed,const double force,const double limit,const double margin,
+                          ContactHeightModel &model,int tray,int pocket,const int timeout = 30000);
     bool resetSoftLanding(int timeout = 30000);
 
     void ShowSetting();
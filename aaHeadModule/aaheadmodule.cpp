@@ -206,6 +206,7 @@ void AAHeadModule::SetAAPosion(mPoint6D point)
 
 mPoint6D AAHeadModule::GetFeedBack()
 {
+    //调用者在运动后取到位位置作为标定或运动目标, 不能用快照
     return mPoint6D(motor_x->GetFeedbackPos(),motor_y->GetFeedbackPos(),motor_z->GetFeedbackPos(),motor_a->GetFeedbackPos(),motor_b->GetFeedbackPos(),motor_c->GetFeedbackPos());
 }
 
@@ -314,7 +315,7 @@ void AAHeadModule::performHandlingOperation(int cmd, QVariant param)
         result = moveToPickLensPosition();
     if(!result)
         sendAlarmMessage(OK_OPERATION,GetCurrentError(),ErrorLevel::TipNonblock);
-    is_handling = false;
+    finishHandling();
 }
 
 bool AAHeadModule::moveToDiffrentZSync(double z)
@@ -1,13 +1,19 @@
 ﻿#include "XtVcMotor.h"
 #include "basemodulemanager.h"
+#include "xtstatesnapshot.h"
+#include "cycletracerecorder.h"
+#include "computepool.h"
+#include "uphSimulation/uphsimulator.h"
 #include "xtvcmotorparameter.h"
 
+#include <QElapsedTimer>
 #include <QMessageBox>
 #include <qcoreapplication.h>
 #include <qdir.h>
 #include <qfileinfo.h>
 #include <qjsonarray.h>
 #include <qjsondocument.h>
+#include <cmath>
 #include "utils/commonutils.h"
 
 wchar_t BaseModuleManager::ip[] =  L"192.168.8.251";
@@ -131,6 +137,10 @@ BaseModuleManager::BaseModuleManager(QObject *parent)
 
 BaseModuleManager::~BaseModuleManager()
 {
+    XtStateSnapshot::instance()->stopThd();
+    exportMotionTiming();
+    if(EnableCycleTrace())
+        exportCycleTrace();
     this->work_thread.quit();
     this->work_thread.wait();
 }
@@ -151,7 +161,7 @@ void BaseModuleManager::tcpResp(QString message)
             if(temp_motor == nullptr)
                 result["error"] =QString("can not find ").append(motor_name);
             else {
-                result["motorPosition"] = temp_motor->GetFeedbackPos();
+                result["motorPosition"] = XtStateSnapshot::instance()->getFeedbackPos(temp_motor);
                 result["motorTargetPosition"] = temp_motor->GetCurrentTragetPos();
                 result["motorHomeState"] = temp_motor->states.seekedOrigin();
                 result["motorEnableState"] = temp_motor->states.isEnabled();
@@ -277,7 +287,7 @@ void BaseModuleManager::tcpResp(QString message)
             if(temp_io == nullptr)
                 result["error"] =QString("can not find ").append(outputIo_name);
             else {
-                result["IoValue"] = temp_io->Value();
+                result["IoValue"] = XtStateSnapshot::instance()->outputValue(temp_io);
                 result["error"] = "";
             }
             receive_messagers[message_object["sender_name"].toString()]->sendMessage(TcpMessager::getStringFromJsonObject(result));
@@ -292,7 +302,7 @@ void BaseModuleManager::tcpResp(QString message)
             if(temp_io == nullptr)
                 result["error"] =QString("can not find ").append(inputIo_name);
             else {
-                result["IoValue"] = temp_io->Value();
+                result["IoValue"] = XtStateSnapshot::instance()->inputValue(temp_io);
                 result["error"] = "";
             }
             receive_messagers[message_object["sender_name"].toString()]->sendMessage(TcpMessager::getStringFromJsonObject(result));
@@ -550,7 +560,7 @@ QString BaseModuleManager::deviceResp(QString message)
                 }
             }
             else {
-                result["motorPosition"] = temp_motor->GetFeedbackPos();
+                result["motorPosition"] = XtStateSnapshot::instance()->getFeedbackPos(temp_motor);
                 result["motorTargetPosition"] = temp_motor->GetCurrentTragetPos();
                 result["motorHomeState"] = temp_motor->states.seekedOrigin();
                 result["motorEnableState"] = temp_motor->states.isEnabled();
@@ -593,7 +603,7 @@ QString BaseModuleManager::deviceResp(QString message)
                     result["error"] = QString("tcp cannot find input io ").append(temp_name);
             }
             else {
-                result["IoValue"] = temp_io->Value();
+                result["IoValue"] = XtStateSnapshot::instance()->inputValue(temp_io);
                 result["error"] = "";
 
             }
@@ -631,7 +641,7 @@ QString BaseModuleManager::deviceResp(QString message)
                     result["error"] = QString("tcp cannot find input io ").append(temp_name);
             }
             else {
-                result["IoValue"] = temp_io->Value();
+                result["IoValue"] = XtStateSnapshot::instance()->outputValue(temp_io);
                 result["error"] = "";
 
             }
@@ -1371,6 +1381,7 @@ bool BaseModuleManager::loadMotorLimitFiles(QString file_name)
            }
         }
         qInfo("%s loadmotorlimit motors limit %d %d %d",temp_motor->Name().toStdString().c_str(),temp_motor->vertical_limit_parameters.count(),temp_motor->parallel_limit_parameters.count(),temp_motor->io_limit_parameters.count());
+        temp_motor->compileLimitIndex();
     }
     return true;
 }
@@ -1633,6 +1644,7 @@ bool BaseModuleManager::InitStruct()
                                   GetVisionLocationByName(sensor_loader_module.parameters.sutSensorLocationName()),
                                   GetVisionLocationByName(sensor_loader_module.parameters.sutProductLocationName()),
                                   GetVisionLocationByName(sensor_loader_module.parameters.calibrationGlassLocationName()),
+                                  GetOutputIoByName(sensor_loader_module.parameters.trayFlyPrIoName(),false),
                                   XtMotor::GetThreadResource());
         //connect(&sensor_loader_module,&SensorLoaderModule::sendMsgSignal,this,&BaseModuleManager::sendMessageTest);
     }
@@ -1648,7 +1660,8 @@ bool BaseModuleManager::InitStruct()
                         GetVacuumByName(lut_module.parameters.vacuum1Name()),
                         GetVacuumByName(lut_module.parameters.vacuum2Name()),
                         GetOutputIoByName(aa_head_module.parameters.gripperName()), &sut_module,
-                        XtMotor::GetThreadResource());
+                        XtMotor::GetThreadResource(),
+                        GetInputIoByName(lut_module.parameters.gripperInputName()));
         lens_picker.Init(GetVcMotorByName(lens_pick_arm.parameters.motorZName()),
                          GetMotorByName(lens_pick_arm.parameters.motorTName()),
                          GetVacuumByName(lens_pick_arm.parameters.vacuumName()));
@@ -1908,6 +1921,10 @@ bool BaseModuleManager::initialDevice()
     foreach (XtMotor *m, motors.values()) {
         m->GetMasterAxisID();
     }
+    XtStateSnapshot::instance()->setSources(motors.values(),input_ios.values(),output_ios.values());
+    XtStateSnapshot::instance()->setRefreshInterval(SnapshotInterval(),SnapshotMaxAge());
+    XtStateSnapshot::instance()->startThd();
+    CycleTraceRecorder::instance()->setEnabled(EnableCycleTrace());
     enableMotors();
 
     if (ServerMode() == 1)
@@ -2235,6 +2252,81 @@ void BaseModuleManager::resetUPH()
     aaCoreNew.parameters.setCalculatedUPH(0);
 }
 
+bool BaseModuleManager::exportMotionTiming()
+{
+    return MotionTimingRecorder::instance()->exportReport();
+}
+
+bool BaseModuleManager::exportCycleTrace()
+{
+    return CycleTraceRecorder::instance()->exportChromeTrace();
+}
+
+QString BaseModuleManager::simulateUPH(QString config_file)
+{
+    UphSimulator simulator;
+    if(!config_file.isEmpty()&&!simulator.loadConfig(config_file))
+        return QString("load uph simulation config %1 fail").arg(config_file);
+    //配置未指定流程图时用当前AA的流程图估算
+    if(!simulator.hasFlowchart())
+        simulator.setFlowchart(aaCoreNew.flowchartDocument.object());
+    return simulator.run();
+}
+
+QString BaseModuleManager::benchmarkComputePool()
+{
+    return ComputePool::instance()->runBenchmark();
+}
+
+QString BaseModuleManager::benchmarkStateSnapshot()
+{
+    return XtStateSnapshot::instance()->runBenchmark();
+}
+
+QString BaseModuleManager::checkMotionExecutor()
+{
+#ifdef XT_SIMULATION
+    //在模拟器上对比LUT上料移动的同步和执行器两种路径, 并检查超时中止后线程资源能继续使用
+    Position3D &from = lut_module.load_uplook_position;
+    Position3D &to = lut_module.load_position;
+    QString report;
+    QElapsedTimer timer;
+    if(!lut_carrier.Move_SZ_SY_X_Y_Z_Sync(from.X(),from.Y(),from.Z()))
+        return "move to load uplook position fail";
+    timer.start();
+    if(!lut_carrier.Move_SZ_SY_X_Y_Z_Sync(to.X(),to.Y(),to.Z()))
+        return "sync move to load position fail";
+    report.append(QString("sync %1 ms").arg(timer.elapsed()));
+    if(!lut_carrier.Move_SZ_SY_X_Y_Z_Sync(from.X(),from.Y(),from.Z()))
+        return "move back to load uplook position fail";
+    timer.restart();
+    XtMotionHandle handle = lut_carrier.Move_SZ_SY_X_Y_Z_Async(to.X(),to.Y(),to.Z());
+    if(!handle.wait())
+        return QString("executor move to load position fail: %1").arg(handle.errorMessage());
+    report.append(QString(", executor %1 ms").arg(timer.elapsed()));
+    XtMotor *motors[3] = {lut_carrier.motor_x,lut_carrier.motor_y,lut_carrier.motor_z};
+    double targets[3] = {to.X(),to.Y(),to.Z()};
+    for (int i = 0; i < 3; ++i) {
+        double error = fabs(motors[i]->GetFeedbackPos() - targets[i]);
+        if(error > motors[i]->parameters.positionError())
+            return QString("%1 not arrived, error %2").arg(motors[i]->Name()).arg(error);
+    }
+    //1ms超时必然中止, 后续段应带着前序失败的信息结束
+    handle = lut_carrier.Move_SZ_SY_X_Y_Z_Async(from.X(),from.Y(),from.Z(),5,1);
+    if(handle.wait())
+        return "executor move with 1 ms timeout did not fail";
+    report.append(QString(", abort: %1").arg(handle.errorMessage()));
+    handle = lut_carrier.Move_SZ_SY_X_Y_Z_Async(to.X(),to.Y(),to.Z());
+    if(!handle.wait())
+        return QString("executor move after abort fail: %1").arg(handle.errorMessage());
+    report.append(", move after abort ok");
+    qInfo("checkMotionExecutor: %s",report.toStdString().c_str());
+    return report;
+#else
+    return "motion executor check runs only on the simulator, build with CONFIG+=xt_simulation";
+#endif
+}
+
 XtMotor *BaseModuleManager::GetMotorByName(QString name)
 {
     if(name == "")return nullptr;
@@ -58,6 +58,9 @@ public:
     Q_PROPERTY(QString ServerURL READ ServerURL WRITE setServerURL NOTIFY paramsChanged)
     Q_PROPERTY(QString DataServerURL READ DataServerURL WRITE setDataServerURL NOTIFY paramsChanged)
     Q_PROPERTY(QString FlowchartFilename READ FlowchartFilename WRITE setFlowchartFilename NOTIFY paramsChanged)
+    Q_PROPERTY(int SnapshotInterval READ SnapshotInterval WRITE setSnapshotInterval NOTIFY paramsChanged)
+    Q_PROPERTY(int SnapshotMaxAge READ SnapshotMaxAge WRITE setSnapshotMaxAge NOTIFY paramsChanged)
+    Q_PROPERTY(bool EnableCycleTrace READ EnableCycleTrace WRITE setEnableCycleTrace NOTIFY paramsChanged)
 
     QMap<QString,ThreadWorkerBase*> workers;
     QMap<QString,ThreadWorkerBase*> tcp_workers;
@@ -251,6 +254,33 @@ public slots:
         emit paramsChanged();
     }
 
+    void setSnapshotInterval(int SnapshotInterval)
+    {
+        if (m_SnapshotInterval == SnapshotInterval)
+            return;
+
+        m_SnapshotInterval = SnapshotInterval;
+        emit paramsChanged();
+    }
+
+    void setSnapshotMaxAge(int SnapshotMaxAge)
+    {
+        if (m_SnapshotMaxAge == SnapshotMaxAge)
+            return;
+
+        m_SnapshotMaxAge = SnapshotMaxAge;
+        emit paramsChanged();
+    }
+
+    void setEnableCycleTrace(bool EnableCycleTrace)
+    {
+        if (m_EnableCycleTrace == EnableCycleTrace)
+            return;
+
+        m_EnableCycleTrace = EnableCycleTrace;
+        emit paramsChanged();
+    }
+
     void setInitState(bool InitState)
     {
         if (m_InitState == InitState)
@@ -296,6 +326,9 @@ private:
     int m_ServerPort = 9999;
     QString m_ServerURL = "ws://localhost:61916";
     int m_ServerMode = 0;
+    int m_SnapshotInterval = 5;
+    int m_SnapshotMaxAge = 20;
+    bool m_EnableCycleTrace = false;
 
     bool m_HomeState = false;
     QTimer timer;
@@ -416,6 +449,12 @@ public:
     Q_INVOKABLE int getServerMode() { return m_ServerMode; }
 
     Q_INVOKABLE void resetUPH();
+    Q_INVOKABLE bool exportMotionTiming();
+    Q_INVOKABLE bool exportCycleTrace();
+    Q_INVOKABLE QString simulateUPH(QString config_file = "");
+    Q_INVOKABLE QString benchmarkComputePool();
+    Q_INVOKABLE QString benchmarkStateSnapshot();
+    Q_INVOKABLE QString checkMotionExecutor();
 
     XtMotor* GetMotorByName(QString name);
     XtVcMotor *GetVcMotorByName(QString name);
@@ -451,6 +490,18 @@ public:
     {
         return m_FlowchartFilename;
     }
+    int SnapshotInterval() const
+    {
+        return m_SnapshotInterval;
+    }
+    int SnapshotMaxAge() const
+    {
+        return m_SnapshotMaxAge;
+    }
+    bool EnableCycleTrace() const
+    {
+        return m_EnableCycleTrace;
+    }
     bool InitState() const
     {
         return m_InitState;
@@ -1,4 +1,5 @@
 ﻿#include "calibration/calibration.h"
+#include <QElapsedTimer>
 #include <QMessageBox>
 #include <visionavadaptor.h>
 #include <QFile>
@@ -91,7 +92,10 @@ bool Calibration::performCalibration()
                 return false;
             }
         }
-        Sleep(1000);
+        //两轴各自等稳定, 总共不超过原来的1000ms
+        QElapsedTimer settle_timer; settle_timer.start();
+        motor_x->WaitSettled(1000);
+        motor_y->WaitSettled(qMax(0,1000 - int(settle_timer.elapsed())));
         if (GetPixelPoint(pixel_x,pixel_y))
         {
             qInfo((name + " mech x: %f y: %f").toStdString().data(), motor_x->GetFeedbackPos(), motor_y->GetFeedbackPos());
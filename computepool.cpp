@@ -0,0 +1,233 @@
+#include "computepool.h"
+#include "cycletracerecorder.h"
+#include <QThread>
+#include <algorithm>
+#include <cmath>
+#include <deque>
+
+namespace
+{
+thread_local int current_worker_index = -1;
+}
+
+class ComputeWorker:public QThread
+{
+public:
+    ComputeWorker(ComputePool *pool, int index)
+        :pool(pool),index(index)
+    {
+        setObjectName(QString("compute %1").arg(index));
+    }
+    QMutex locker;
+    std::deque<ComputePool::Task> queues[ComputePool::PriorityCount];
+
+protected:
+    void run() override
+    {
+        current_worker_index = index;
+        pool->execute(index);
+    }
+
+private:
+    ComputePool *pool;
+    int index;
+};
+
+ComputePool::ComputePool()
+{
+    clock.start();
+    for (int i = 0; i < PriorityCount; ++i)
+        priority_metrics[i].latencys.reserve(LATENCY_SAMPLES);
+    //至少留一个线程给后台任务
+    int count = qMax(2,QThread::idealThreadCount());
+    for (int i = 0; i < count; ++i) {
+        ComputeWorker *worker = new ComputeWorker(this,i);
+        workers.append(worker);
+    }
+    foreach (ComputeWorker *worker, workers)
+        worker->start();
+    qInfo("compute pool started with %d workers",count);
+}
+
+ComputePool *ComputePool::instance()
+{
+    static ComputePool pool;
+    return &pool;
+}
+
+ComputePool::~ComputePool()
+{
+    stopping.storeRelease(1);
+    {
+        QMutexLocker tmpLocker(&sleep_locker);
+        task_added.wakeAll();
+    }
+    foreach (ComputeWorker *worker, workers) {
+        worker->wait();
+        delete worker;
+    }
+    workers.clear();
+}
+
+qint64 ComputePool::now() const
+{
+    return clock.nsecsElapsed()/1000;
+}
+
+void ComputePool::push(std::function<void()> run, Priority priority, int affinity)
+{
+    int count = workers.size();
+    int index = affinity;
+    if(index < 0)
+        index = current_worker_index;
+    if(index < 0)
+        index = int(uint(next_worker.fetchAndAddRelaxed(1))%uint(count));
+    index %= count;
+    //0号线程只跑关键任务
+    if(priority == Background&&index == 0)
+        index = 1 + int(uint(next_worker.fetchAndAddRelaxed(1))%uint(count - 1));
+    Task task = {run,priority,now(),CycleTraceRecorder::instance()->currentUnit()};
+    {
+        QMutexLocker tmpLocker(&workers[index]->locker);
+        workers[index]->queues[priority].push_back(std::move(task));
+    }
+    pending.fetchAndAddOrdered(1);
+    if(priority == Critical)
+        critical_pending.fetchAndAddOrdered(1);
+    QMutexLocker tmpLocker(&sleep_locker);
+    task_added.wakeAll();
+}
+
+bool ComputePool::pop(int index, Task &task, bool &stolen)
+{
+    int count = workers.size();
+    int last_priority = index == 0?Critical:Background;
+    for (int priority = Critical; priority <= last_priority; ++priority) {
+        {
+            ComputeWorker *worker = workers[index];
+            QMutexLocker tmpLocker(&worker->locker);
+            if(!worker->queues[priority].empty())
+            {
+                task = std::move(worker->queues[priority].front());
+                worker->queues[priority].pop_front();
+                stolen = false;
+                return true;
+            }
+        }
+        //从其他线程队尾偷取
+        for (int i = 1; i < count; ++i) {
+            ComputeWorker *worker = workers[(index + i)%count];
+            QMutexLocker tmpLocker(&worker->locker);
+            if(!worker->queues[priority].empty())
+            {
+                task = std::move(worker->queues[priority].back());
+                worker->queues[priority].pop_back();
+                stolen = true;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void ComputePool::execute(int index)
+{
+    while (stopping.loadAcquire() == 0) {
+        Task task;
+        bool stolen = false;
+        if(pop(index,task,stolen))
+        {
+            pending.fetchAndAddOrdered(-1);
+            if(task.priority == Critical)
+                critical_pending.fetchAndAddOrdered(-1);
+            qint64 start = now();
+            {
+                TraceUnitScope unit_scope(task.trace_unit);
+                TraceSpan span("compute",task.priority == Critical?"critical":"background");
+                task.run();
+            }
+            record(task,start,now(),stolen);
+            continue;
+        }
+        //计数在加锁后检查, push在同一把锁下唤醒, 不会漏掉新任务
+        QMutexLocker tmpLocker(&sleep_locker);
+        QAtomicInt &waiting = index == 0?critical_pending:pending;
+        if(waiting.loadAcquire() == 0&&stopping.loadAcquire() == 0)
+            task_added.wait(&sleep_locker);
+    }
+}
+
+void ComputePool::record(const Task &task, qint64 start, qint64 end, bool stolen)
+{
+    QMutexLocker tmpLocker(&metrics_locker);
+    Metrics &metrics = priority_metrics[task.priority];
+    metrics.count++;
+    if(stolen)
+        metrics.steal_count++;
+    metrics.wait_sum += start - task.submit_time;
+    metrics.run_sum += end - start;
+    if(metrics.latencys.size() < LATENCY_SAMPLES)
+        metrics.latencys.append(end - task.submit_time);
+    else
+        metrics.latencys[metrics.latency_index] = end - task.submit_time;
+    metrics.latency_index = (metrics.latency_index + 1)%LATENCY_SAMPLES;
+}
+
+QString ComputePool::metrics()
+{
+    const char *names[PriorityCount] = {"critical","background"};
+    QStringList result;
+    QMutexLocker tmpLocker(&metrics_locker);
+    for (int i = 0; i < PriorityCount; ++i) {
+        const Metrics &metrics = priority_metrics[i];
+        QVector<qint64> latencys = metrics.latencys;
+        std::sort(latencys.begin(),latencys.end());
+        auto percentile = [&latencys](double ratio) {
+            return latencys.isEmpty()?0.0:latencys[qMin(latencys.size() - 1,int(latencys.size()*ratio))]/1000.0;
+        };
+        result << QString("%1 tasks %2 stolen %3 avg wait %4 ms avg run %5 ms latency p50 %6 ms p99 %7 ms max %8 ms")
+                  .arg(names[i]).arg(metrics.count).arg(metrics.steal_count)
+                  .arg(metrics.count > 0?metrics.wait_sum/1000.0/metrics.count:0,0,'f',3)
+                  .arg(metrics.count > 0?metrics.run_sum/1000.0/metrics.count:0,0,'f',3)
+                  .arg(percentile(0.5),0,'f',3).arg(percentile(0.99),0,'f',3)
+                  .arg(latencys.isEmpty()?0:latencys.last()/1000.0,0,'f',3);
+    }
+    return result.join("\n");
+}
+
+void ComputePool::resetMetrics()
+{
+    QMutexLocker tmpLocker(&metrics_locker);
+    for (int i = 0; i < PriorityCount; ++i) {
+        priority_metrics[i] = Metrics();
+        priority_metrics[i].latencys.reserve(LATENCY_SAMPLES);
+    }
+}
+
+QString ComputePool::runBenchmark(int critical_count, int background_count)
+{
+    //模拟AA取图计算(1ms)在大量后台存图(5ms)下的尾延时, 不要在生产时运行
+    auto spin = [](qint64 us) {
+        QElapsedTimer timer; timer.start();
+        volatile double value = 0;
+        while (timer.nsecsElapsed()/1000 < us)
+            value = value + std::sqrt(value + 1);
+    };
+    resetMetrics();
+    QElapsedTimer timer; timer.start();
+    std::vector<std::future<void>> futures;
+    futures.reserve(size_t(critical_count + background_count));
+    for (int i = 0; i < background_count; ++i)
+        futures.push_back(submit([spin](){ spin(5000); },Background));
+    for (int i = 0; i < critical_count; ++i) {
+        futures.push_back(submit([spin](){ spin(1000); },Critical));
+        QThread::msleep(2);
+    }
+    for (std::future<void> &future : futures)
+        future.wait();
+    QString result = QString("compute pool benchmark workers %1 critical %2 background %3 in %4 ms\n%5")
+            .arg(workerCount()).arg(critical_count).arg(background_count).arg(timer.elapsed()).arg(metrics());
+    foreach (QString line, result.split("\n"))
+        qInfo("%s",line.toStdString().c_str());
+    return result;
+}
@@ -0,0 +1,93 @@
+#ifndef COMPUTEPOOL_H
+#define COMPUTEPOOL_H
+
+#include <QAtomicInt>
+#include <QElapsedTimer>
+#include <QList>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+#include <QWaitCondition>
+#include <functional>
+#include <future>
+#include <memory>
+
+class ComputeWorker;
+
+/*
+ * Process-wide pool for CPU-heavy image and math work (SFR, pattern search,
+ * PR, image encoding). Every worker owns a deque per priority; a task goes
+ * to the worker named by its affinity hint, to the submitting worker, or
+ * round-robin, and idle workers steal from the back of the others' deques.
+ * Critical tasks are always taken before background ones, and worker 0 only
+ * runs critical tasks so AA work never waits behind a long background job.
+ * Tasks must not block on motion or on other pool tasks.
+ */
+class ComputePool
+{
+public:
+    enum Priority
+    {
+        Critical = 0,   //AA测试路径上的计算
+        Background,     //存图、编码等
+        PriorityCount
+    };
+    static ComputePool *instance();
+    ~ComputePool();
+
+    template<typename F>
+    auto submit(F &&function, Priority priority = Background, int affinity = -1) -> std::future<decltype(function())>
+    {
+        typedef decltype(function()) Result;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(function));
+        std::future<Result> result = task->get_future();
+        push([task](){ (*task)(); },priority,affinity);
+        return result;
+    }
+    int workerCount() const
+    {
+        return workers.size();
+    }
+    QString metrics();
+    void resetMetrics();
+    QString runBenchmark(int critical_count = 200, int background_count = 2000);
+
+private:
+    friend class ComputeWorker;
+    struct Task
+    {
+        std::function<void()> run;
+        int priority;
+        qint64 submit_time;
+        qint32 trace_unit;
+    };
+    struct Metrics
+    {
+        qint64 count = 0;
+        qint64 steal_count = 0;
+        qint64 wait_sum = 0;
+        qint64 run_sum = 0;
+        QVector<qint64> latencys;   //最近的提交到完成时间, 循环覆盖
+        int latency_index = 0;
+    };
+    explicit ComputePool();
+    void push(std::function<void()> run, Priority priority, int affinity);
+    bool pop(int index, Task &task, bool &stolen);
+    void execute(int index);
+    void record(const Task &task, qint64 start, qint64 end, bool stolen);
+    qint64 now() const;
+
+    const int LATENCY_SAMPLES = 4096;
+    QList<ComputeWorker*> workers;
+    QAtomicInt next_worker;
+    QAtomicInt pending;
+    QAtomicInt critical_pending;    //0号线程只在有关键任务时唤醒
+    QAtomicInt stopping;
+    QMutex sleep_locker;
+    QWaitCondition task_added;
+    QElapsedTimer clock;
+    QMutex metrics_locker;
+    Metrics priority_metrics[PriorityCount];
+};
+
+#endif // COMPUTEPOOL_H
@@ -0,0 +1,114 @@
+#include "contactheightmodel.h"
+#include <QMutexLocker>
+#include <qmath.h>
+
+void ContactHeightModel::setParameters(int min_samples, double sigma_factor, double min_band, double max_band)
+{
+    QMutexLocker tmpLocker(&locker);
+    minSamples = qMax(1,min_samples);
+    sigmaFactor = qMax(0.0,sigma_factor);
+    minBand = qMax(0.0,min_band);
+    maxBand = qMax(minBand,max_band);
+}
+
+bool ContactHeightModel::predict(const Estimate &estimate, double &contact, double &band) const
+{
+    if(estimate.count < minSamples)
+        return false;
+    double temp_band = qMax(minBand,sigmaFactor*qSqrt(estimate.variance));
+    //离散太大时不做预测
+    if(temp_band > maxBand)
+        return false;
+    contact = estimate.mean;
+    band = temp_band;
+    return true;
+}
+
+bool ContactHeightModel::predict(int tray, int pocket, double &contact, double &band)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(predict(estimates.value(QPair<int,int>(tray,pocket)),contact,band))
+        return true;
+    return predict(estimates.value(QPair<int,int>(tray,-1)),contact,band);
+}
+
+void ContactHeightModel::merge(Estimate &estimate, double contact)
+{
+    double temp_contact, band;
+    if(predict(estimate,temp_contact,band)&&qAbs(contact - temp_contact) > band)
+    {
+        //连续超出才认为高度真的变了
+        estimate.outlierCount++;
+        if(estimate.outlierCount < MAX_OUTLIER_COUNT)
+            return;
+        estimate = Estimate();
+    }
+    estimate.outlierCount = 0;
+    if(estimate.count == 0)
+    {
+        estimate.mean = contact;
+        estimate.variance = 0;
+    }
+    else
+    {
+        //样本少时按算术平均, 之后指数加权
+        double weight = qMax(SMOOTHING,1.0/(estimate.count + 1));
+        double diff = contact - estimate.mean;
+        estimate.mean += weight*diff;
+        estimate.variance = (1 - weight)*(estimate.variance + weight*diff*diff);
+    }
+    estimate.count++;
+}
+
+void ContactHeightModel::update(int tray, int pocket, double contact)
+{
+    QMutexLocker tmpLocker(&locker);
+    merge(estimates[QPair<int,int>(tray,pocket)],contact);
+    if(pocket >= 0)
+        merge(estimates[QPair<int,int>(tray,-1)],contact);
+}
+
+void ContactHeightModel::reset(int tray)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(tray < 0)
+    {
+        estimates.clear();
+        return;
+    }
+    QList<QPair<int,int>> keys = estimates.keys();
+    foreach (QPair<int,int> key, keys) {
+        if(key.first == tray)
+            estimates.remove(key);
+    }
+}
+
+void ContactHeightModel::recordPick(bool learned, bool fallback, qint64 time, double error)
+{
+    QMutexLocker tmpLocker(&locker);
+    PickStatistics &statistics = learned&&!fallback?learnedStatistics:fullStatistics;
+    statistics.count++;
+    statistics.time += time;
+    statistics.maxTime = qMax(statistics.maxTime,time);
+    if(learned&&!fallback)
+    {
+        statistics.error += qAbs(error);
+        statistics.maxError = qMax(statistics.maxError,qAbs(error));
+    }
+    if(fallback)
+        fallbackCount++;
+}
+
+void ContactHeightModel::logStatistics(QString name)
+{
+    QMutexLocker tmpLocker(&locker);
+    qInfo("%s contact model pockets %d, learned pick %d avg %lld ms max %lld ms avg error %f max error %f, full pick %d avg %lld ms max %lld ms, fallback %d",
+          name.toStdString().c_str(),estimates.size(),
+          learnedStatistics.count,learnedStatistics.count > 0?learnedStatistics.time/learnedStatistics.count:0,learnedStatistics.maxTime,
+          learnedStatistics.count > 0?learnedStatistics.error/learnedStatistics.count:0,learnedStatistics.maxError,
+          fullStatistics.count,fullStatistics.count > 0?fullStatistics.time/fullStatistics.count:0,fullStatistics.maxTime,
+          fallbackCount);
+    learnedStatistics = PickStatistics();
+    fullStatistics = PickStatistics();
+    fallbackCount = 0;
+}
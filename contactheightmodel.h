@@ -0,0 +1,60 @@
+#ifndef CONTACTHEIGHTMODEL_H
+#define CONTACTHEIGHTMODEL_H
+
+#include <QMap>
+#include <QMutex>
+#include <QPair>
+
+/*
+ * Contact height learned from previous soft landings, per tray and pocket.
+ * Each pocket keeps an exponentially weighted mean and variance of the
+ * landed position; a pocket without enough samples uses the estimate of its
+ * tray. The prediction band is the larger of a minimum band and a multiple
+ * of the standard deviation, so the fast approach stops short of any
+ * contact seen so far. Landings outside the band are outliers and are not
+ * merged; after several in a row the estimate restarts from the new height.
+ */
+class ContactHeightModel
+{
+public:
+    void setParameters(int min_samples, double sigma_factor, double min_band, double max_band);
+    bool predict(int tray, int pocket, double &contact, double &band);
+    void update(int tray, int pocket, double contact);
+    void reset(int tray = -1);
+    void recordPick(bool learned, bool fallback, qint64 time, double error);
+    void logStatistics(QString name);
+
+private:
+    struct Estimate
+    {
+        int count = 0;
+        double mean = 0;
+        double variance = 0;
+        int outlierCount = 0;
+    };
+    struct PickStatistics
+    {
+        int count = 0;
+        qint64 time = 0;
+        qint64 maxTime = 0;
+        double error = 0;
+        double maxError = 0;
+    };
+    bool predict(const Estimate &estimate, double &contact, double &band) const;
+    void merge(Estimate &estimate, double contact);
+
+    const int MAX_OUTLIER_COUNT = 3;
+    const double SMOOTHING = 0.3;
+    int minSamples = 3;
+    double sigmaFactor = 4;
+    double minBand = 0.1;
+    double maxBand = 1;
+    //key: tray, pocket; pocket -1为整盘估计
+    QMap<QPair<int,int>,Estimate> estimates;
+    PickStatistics learnedStatistics;
+    PickStatistics fullStatistics;
+    int fallbackCount = 0;
+    QMutex locker;
+};
+
+#endif // CONTACTHEIGHTMODEL_H
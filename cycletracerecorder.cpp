@@ -0,0 +1,266 @@
+#include "cycletracerecorder.h"
+#include "utils/commonutils.h"
+#include <QFile>
+#include <QThread>
+#include <QTextStream>
+
+namespace {
+thread_local qint32 current_unit = -1;
+}
+
+CycleTraceRecorder::CycleTraceRecorder()
+{
+    clock.start();
+}
+
+CycleTraceRecorder *CycleTraceRecorder::instance()
+{
+    static CycleTraceRecorder recorder;
+    return &recorder;
+}
+
+void CycleTraceRecorder::setEnabled(bool enabled)
+{
+    this->enabled.storeRelease(enabled?1:0);
+    qInfo("cycle trace %s",enabled?"enabled":"disabled");
+}
+
+qint64 CycleTraceRecorder::now() const
+{
+    return clock.nsecsElapsed()/1000;
+}
+
+int CycleTraceRecorder::intern(const QString &text)
+{
+    QMutexLocker tmpLocker(&locker);
+    int index = detailIndex.value(text,-1);
+    if(index < 0)
+    {
+        index = details.size();
+        details.append(text);
+        detailIndex.insert(text,index);
+    }
+    return index;
+}
+
+void CycleTraceRecorder::setCurrentUnit(const QString &unit)
+{
+    setCurrentUnit(isEnabled()&&!unit.isEmpty()?intern(unit):-1);
+}
+
+void CycleTraceRecorder::setCurrentUnit(qint32 unit)
+{
+    current_unit = unit;
+}
+
+qint32 CycleTraceRecorder::currentUnit() const
+{
+    return current_unit;
+}
+
+CycleTraceRecorder::BufferHandle::~BufferHandle()
+{
+    CycleTraceRecorder::instance()->releaseBuffer(buffer);
+}
+
+CycleTraceRecorder::ThreadBuffer *CycleTraceRecorder::currentBuffer()
+{
+    //每个线程第一次记录时取一个空闲缓冲, 线程结束时归还, 缓冲里的事件保留以便导出
+    BufferHandle *handle = threadBuffers.localData();
+    if(handle != nullptr)
+        return handle->buffer;
+    QString thread_name = QThread::currentThread()->objectName();
+    ThreadBuffer *buffer;
+    {
+        QMutexLocker tmpLocker(&locker);
+        if(freeBuffers.isEmpty())
+        {
+            buffer = new ThreadBuffer();
+            buffer->events.resize(BUFFER_SIZE);
+            buffer->count.storeRelease(0);
+            buffers.append(buffer);
+        }
+        else
+            buffer = freeBuffers.takeLast();
+        Owner owner = {buffer->count.loadAcquire(),nextThreadId++,thread_name};
+        if(owner.threadName.isEmpty())
+            owner.threadName = QString("thread %1").arg(owner.threadId);
+        //事件已被完全覆盖的旧线程不再保留
+        while (buffer->owners.size() > 1&&buffer->owners[1].startCount <= owner.startCount - BUFFER_SIZE)
+            buffer->owners.removeFirst();
+        buffer->owners.append(owner);
+    }
+    handle = new BufferHandle();
+    handle->buffer = buffer;
+    threadBuffers.setLocalData(handle);
+    return buffer;
+}
+
+void CycleTraceRecorder::releaseBuffer(ThreadBuffer *buffer)
+{
+    QMutexLocker tmpLocker(&locker);
+    freeBuffers.append(buffer);
+}
+
+void CycleTraceRecorder::append(const Event &event)
+{
+    ThreadBuffer *buffer = currentBuffer();
+    qint64 count = buffer->count.load();
+    buffer->events[int(count%BUFFER_SIZE)] = event;
+    buffer->count.storeRelease(count + 1);
+}
+
+void CycleTraceRecorder::complete(const char *category, const char *name, qint64 start, qint32 detail)
+{
+    if(!isEnabled())
+        return;
+    Event event = {start,now() - start,category,name,detail,current_unit};
+    append(event);
+}
+
+void CycleTraceRecorder::instant(const char *category, const char *name, qint32 detail)
+{
+    if(!isEnabled())
+        return;
+    Event event = {now(),-1,category,name,detail,current_unit};
+    append(event);
+}
+
+void CycleTraceRecorder::clear()
+{
+    //各线程缓冲不加锁, 只记下清除时间, 导出时跳过之前的事件
+    clearTime.storeRelease(now());
+}
+
+QString CycleTraceRecorder::escape(const QString &text)
+{
+    QString result;
+    foreach (QChar c, text) {
+        if(c == '"'||c == '\\')
+            result.append('\\').append(c);
+        else if(c.unicode() < 0x20)
+            result.append(QString("\\u%1").arg(int(c.unicode()),4,16,QChar('0')));
+        else
+            result.append(c);
+    }
+    return result;
+}
+
+bool CycleTraceRecorder::exportChromeTrace(QString file_name)
+{
+    if(file_name.isEmpty())
+        file_name = QString(getPerformanceLogDir()).append(getCurrentTimeString()).append("_cycle_trace.json");
+    QList<ThreadBuffer*> temp_buffers;
+    QList<QList<Owner>> temp_owners;
+    QList<qint64> temp_ends;
+    QStringList temp_details;
+    {
+        //缓冲换主人时在同一把锁下记录起始序号, 这里取的结束序号之后的事件不会算错线程
+        QMutexLocker tmpLocker(&locker);
+        temp_buffers = buffers;
+        temp_details = details;
+        foreach (ThreadBuffer *buffer, buffers) {
+            temp_owners.append(buffer->owners);
+            temp_ends.append(buffer->count.loadAcquire());
+        }
+    }
+    QFile file(file_name);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        qWarning("open %s fail",file_name.toStdString().c_str());
+        return false;
+    }
+    QTextStream trace(&file);
+    trace.setCodec("UTF-8");
+    trace << "{\"traceEvents\":[\n";
+    bool first_event = true;
+    int event_count = 0, dropped_count = 0, thread_count = 0;
+    qint64 clear_time = clearTime.loadAcquire();
+    for (int b = 0; b < temp_buffers.size(); ++b) {
+        ThreadBuffer *buffer = temp_buffers[b];
+        const QList<Owner> &owners = temp_owners[b];
+        foreach (const Owner &owner, owners) {
+            if(!first_event)
+                trace << ",\n";
+            first_event = false;
+            trace << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << owner.threadId
+                  << ",\"args\":{\"name\":\"" << escape(owner.threadName) << "\"}}";
+            thread_count++;
+        }
+        //先复制再确认复制期间没有被覆盖的部分
+        qint64 end = temp_ends[b];
+        qint64 begin = qMax(qint64(0),end - BUFFER_SIZE);
+        QVector<Event> events;
+        events.reserve(int(end - begin));
+        for (qint64 i = begin; i < end; ++i)
+            events.append(buffer->events[int(i%BUFFER_SIZE)]);
+        qint64 valid = qMax(begin,buffer->count.loadAcquire() - BUFFER_SIZE + 1);
+        dropped_count += int(valid - begin);
+        int owner_index = 0;
+        for (qint64 i = valid; i < end; ++i)
+        {
+            while (owner_index + 1 < owners.size()&&owners[owner_index + 1].startCount <= i)
+                owner_index++;
+            const Event &event = events[int(i - begin)];
+            if(event.start < clear_time)
+                continue;
+            trace << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category << "\",\"pid\":1,\"tid\":" << owners[owner_index].threadId
+                  << ",\"ts\":" << event.start;
+            if(event.duration < 0)
+                trace << ",\"ph\":\"i\",\"s\":\"t\"";
+            else
+                trace << ",\"ph\":\"X\",\"dur\":" << event.duration;
+            bool has_detail = event.detail >= 0&&event.detail < temp_details.size();
+            bool has_unit = event.unit >= 0&&event.unit < temp_details.size();
+            if(has_detail||has_unit)
+            {
+                trace << ",\"args\":{";
+                if(has_detail)
+                    trace << "\"detail\":\"" << escape(temp_details[event.detail]) << "\"";
+                if(has_unit)
+                    trace << (has_detail?",":"") << "\"unit\":\"" << escape(temp_details[event.unit]) << "\"";
+                trace << "}";
+            }
+            trace << "}";
+            event_count++;
+        }
+    }
+    trace << "\n]}\n";
+    file.close();
+    qInfo("export cycle trace %s threads %d buffers %d events %d dropped %d",file_name.toStdString().c_str(),thread_count,temp_buffers.size(),event_count,dropped_count);
+    return true;
+}
+
+TraceUnitScope::TraceUnitScope(qint32 unit)
+    :previous(CycleTraceRecorder::instance()->currentUnit())
+{
+    CycleTraceRecorder::instance()->setCurrentUnit(unit);
+}
+
+TraceUnitScope::~TraceUnitScope()
+{
+    CycleTraceRecorder::instance()->setCurrentUnit(previous);
+}
+
+TraceSpan::TraceSpan(const char *category, const char *name, qint32 detail)
+    :category(category),name(name),detail(detail),start(-1)
+{
+    if(CycleTraceRecorder::instance()->isEnabled())
+        start = CycleTraceRecorder::instance()->now();
+}
+
+TraceSpan::TraceSpan(const char *category, const char *name, const QString &detail)
+    :category(category),name(name),detail(-1),start(-1)
+{
+    if(CycleTraceRecorder::instance()->isEnabled())
+    {
+        this->detail = CycleTraceRecorder::instance()->intern(detail);
+        start = CycleTraceRecorder::instance()->now();
+    }
+}
+
+TraceSpan::~TraceSpan()
+{
+    if(start >= 0)
+        CycleTraceRecorder::instance()->complete(category,name,start,detail);
+}
@@ -0,0 +1,120 @@
+#ifndef CYCLETRACERECORDER_H
+#define CYCLETRACERECORDER_H
+
+#include <QAtomicInteger>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QString>
+#include <QStringList>
+#include <QThreadStorage>
+#include <QVector>
+
+/*
+ * Machine-wide span and event trace for finding the cycle bottleneck.
+ * Every thread writes into its own ring buffer without locking, on one
+ * monotonic clock shared by all threads. exportChromeTrace copies the rings
+ * while they are being written, drops the events that may have been
+ * overwritten during the copy and writes a Chrome trace json, which
+ * chrome://tracing or Perfetto shows as one timeline per module thread.
+ * Names and categories must be string literals; variable text such as an
+ * axis or test item name is passed as an interned detail.
+ * A ring is returned to a free list when its thread exits and handed to the
+ * next new thread, so short-lived pool threads do not each keep one; the
+ * ring remembers from which event on each owner wrote into it.
+ * Every event also carries the unit (serial) the thread was working on.
+ */
+class CycleTraceRecorder
+{
+public:
+    struct Event
+    {
+        qint64 start;       //us
+        qint64 duration;    //us, -1为瞬时事件
+        const char *category;
+        const char *name;
+        qint32 detail;      //详情字符串索引, -1为无
+        qint32 unit;        //单元序号字符串索引, -1为无
+    };
+
+    static CycleTraceRecorder *instance();
+    void setEnabled(bool enabled);
+    bool isEnabled() const
+    {
+        return enabled.loadAcquire() != 0;
+    }
+    qint64 now() const;
+    int intern(const QString &text);
+    //当前线程正在处理的单元, 之后记录的事件都带上它
+    void setCurrentUnit(const QString &unit);
+    void setCurrentUnit(qint32 unit);
+    qint32 currentUnit() const;
+    void complete(const char *category, const char *name, qint64 start, qint32 detail = -1);
+    void instant(const char *category, const char *name, qint32 detail = -1);
+    bool exportChromeTrace(QString file_name = "");
+    void clear();
+
+private:
+    CycleTraceRecorder();
+
+    struct Owner
+    {
+        qint64 startCount;  //该线程写入的第一个事件序号
+        int threadId;
+        QString threadName;
+    };
+    struct ThreadBuffer
+    {
+        QVector<Event> events;
+        QAtomicInteger<qint64> count;
+        QList<Owner> owners;
+    };
+    struct BufferHandle
+    {
+        ThreadBuffer *buffer;
+        ~BufferHandle();
+    };
+    ThreadBuffer *currentBuffer();
+    void releaseBuffer(ThreadBuffer *buffer);
+    void append(const Event &event);
+    static QString escape(const QString &text);
+
+    const int BUFFER_SIZE = 65536;
+    QAtomicInt enabled;
+    QAtomicInteger<qint64> clearTime;
+    QElapsedTimer clock;
+    QMutex locker;
+    QList<ThreadBuffer*> buffers;
+    QList<ThreadBuffer*> freeBuffers;
+    QThreadStorage<BufferHandle*> threadBuffers;
+    int nextThreadId = 1;
+    QStringList details;
+    QHash<QString,int> detailIndex;
+};
+
+class TraceUnitScope
+{
+public:
+    explicit TraceUnitScope(qint32 unit);
+    ~TraceUnitScope();
+
+private:
+    qint32 previous;
+};
+
+class TraceSpan
+{
+public:
+    TraceSpan(const char *category, const char *name, qint32 detail = -1);
+    TraceSpan(const char *category, const char *name, const QString &detail);
+    ~TraceSpan();
+
+private:
+    const char *category;
+    const char *name;
+    qint32 detail;
+    qint64 start;
+};
+
+#endif // CYCLETRACERECORDER_H
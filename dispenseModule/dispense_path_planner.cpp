@@ -0,0 +1,186 @@
+#include "dispenseModule/dispense_path_planner.h"
+#include <qmath.h>
+
+double DispensePathPlanner::distance(const QVector<double> &from, const QVector<double> &to)
+{
+    double square = 0;
+    for (int i = 0; i < from.size() && i < to.size(); ++i)
+        square += (to[i] - from[i])*(to[i] - from[i]);
+    return qSqrt(square);
+}
+
+double DispensePathPlanner::distanceToLine(const QVector<double> &point, const QVector<double> &from, const QVector<double> &to)
+{
+    double length = distance(from,to);
+    if(length <= 0)
+        return distance(from,point);
+    //投影到线段上, 超出两端时取到端点的距离
+    double t = 0;
+    for (int i = 0; i < from.size(); ++i)
+        t += (point[i] - from[i])*(to[i] - from[i]);
+    t = qBound(0.0,t/(length*length),1.0);
+    double square = 0;
+    for (int i = 0; i < from.size(); ++i)
+    {
+        double d = point[i] - (from[i] + t*(to[i] - from[i]));
+        square += d*d;
+    }
+    return qSqrt(square);
+}
+
+QVector<DispensePathPlanner::Segment> DispensePathPlanner::simplify(const QVector<double> &start, const QVector<Segment> &segments,
+                                                                    double tolerance, QVector<int> &source_index, QVector<double> &source_offset)
+{
+    QVector<Segment> result;
+    source_index.clear();
+    source_offset.clear();
+    QVector<double> run_start = start;
+    int i = 0;
+    while (i < segments.size())
+    {
+        //从第i段开始向后合并, 要求线速度和终点速度相同, 中间各点到合并后直线的距离都在公差内
+        int last = i;
+        if(distance(run_start,segments[i].end) > 0)
+        {
+            for (int j = i + 1; j < segments.size(); ++j)
+            {
+                //被合并的中间点不再单独减速, 所以其终点速度也要和本段相同
+                if(!qFuzzyCompare(segments[j].maxVel + 1,segments[i].maxVel + 1)||!qFuzzyCompare(segments[j-1].endVel + 1,segments[j].endVel + 1)
+                        ||distance(segments[j-1].end,segments[j].end) <= 0)
+                    break;
+                bool in_tolerance = true;
+                for (int k = i; k < j && in_tolerance; ++k)
+                    in_tolerance = distanceToLine(segments[k].end,run_start,segments[j].end) <= tolerance;
+                if(!in_tolerance)
+                    break;
+                last = j;
+            }
+        }
+        double offset = 0;
+        QVector<double> from = run_start;
+        for (int k = i; k <= last; ++k)
+        {
+            source_index.append(result.size());
+            source_offset.append(offset);
+            offset += distance(from,segments[k].end);
+            from = segments[k].end;
+        }
+        result.append(segments[last]);
+        run_start = segments[last].end;
+        i = last + 1;
+    }
+    return result;
+}
+
+double DispensePathPlanner::cornerSpeed(const QVector<double> &from, const QVector<double> &corner, const QVector<double> &to,
+                                        double acc, double corner_deviation)
+{
+    double in_length = distance(from,corner);
+    double out_length = distance(corner,to);
+    if(in_length <= 0||out_length <= 0)
+        return 1e9;
+    //按允许的拐角偏差估算过角速度, 夹角越大速度越低
+    double cos_theta = 0;
+    for (int i = 0; i < corner.size(); ++i)
+        cos_theta -= (corner[i] - from[i])/in_length*(to[i] - corner[i])/out_length;
+    if(cos_theta < -0.999999)
+        return 1e9;
+    double sin_half = qSqrt(qMax(0.0,(1 - cos_theta)/2));
+    if(sin_half >= 0.999999)
+        return 0;
+    return qSqrt(acc*corner_deviation*sin_half/(1 - sin_half));
+}
+
+double DispensePathPlanner::reachableSpeed(double vel, double length, double acc, double jerk)
+{
+    if(acc <= 0)
+        return vel;
+    //速度变化dv需要的距离, 有加加速度时按S型加减速计算
+    auto need_length = [vel,acc,jerk](double dv)
+    {
+        double time = dv/acc;
+        if(jerk > 0)
+            time = dv >= acc*acc/jerk?dv/acc + acc/jerk:2*qSqrt(dv/jerk);
+        return (vel + dv/2)*time;
+    };
+    double low = 0, high = qSqrt(vel*vel + 2*acc*length) - vel;
+    if(need_length(high) <= length)
+        return vel + high;
+    for (int i = 0; i < 40; ++i)
+    {
+        double middle = (low + high)/2;
+        if(need_length(middle) <= length)
+            low = middle;
+        else
+            high = middle;
+    }
+    return vel + low;
+}
+
+void DispensePathPlanner::planSpeeds(const QVector<double> &start, QVector<Segment> &segments, double acc, double jerk,
+                                     double corner_deviation)
+{
+    int count = segments.size();
+    if(count == 0)
+        return;
+    QVector<double> lengths;
+    QVector<double> limits;
+    for (int i = 0; i < count; ++i)
+    {
+        const QVector<double> &from = i == 0?start:segments[i-1].end;
+        lengths.append(distance(from,segments[i].end));
+        //配置的终点速度只会被降低, 不会被提高
+        double limit = qMin(segments[i].endVel,segments[i].maxVel);
+        if(i < count - 1)
+            limit = qMin(qMin(limit,segments[i+1].maxVel),
+                         cornerSpeed(from,segments[i].end,segments[i+1].end,acc,corner_deviation));
+        limits.append(limit);
+    }
+    //反向: 每个顶点的速度要能在后面的线段内降到下一个顶点的速度
+    for (int i = count - 2; i >= 0; --i)
+        limits[i] = qMin(limits[i],reachableSpeed(limits[i+1],lengths[i+1],acc,jerk));
+    //正向: 从静止起步能加到的速度
+    double vel = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        limits[i] = qMin(limits[i],reachableSpeed(vel,lengths[i],acc,jerk));
+        segments[i].endVel = limits[i];
+        vel = limits[i];
+    }
+}
+
+double DispensePathPlanner::estimateTime(const QVector<double> &start, const QVector<Segment> &segments, double acc, double &speed_variance)
+{
+    double total_time = 0, speed_time = 0, square_speed_time = 0;
+    double vel = 0;
+    QVector<double> from = start;
+    foreach (Segment segment, segments)
+    {
+        double length = distance(from,segment.end);
+        from = segment.end;
+        double end_vel = segment.endVel;
+        if(length <= 0||acc <= 0||segment.maxVel <= 0)
+        {
+            vel = qMin(vel,end_vel);
+            continue;
+        }
+        //梯形速度: 加速到峰值, 匀速, 减速到终点速度
+        double peak = qMin(segment.maxVel,qSqrt((2*acc*length + vel*vel + end_vel*end_vel)/2));
+        peak = qMax(peak,qMax(vel,end_vel));
+        double acc_time = (peak - vel)/acc;
+        double dec_time = (peak - end_vel)/acc;
+        double cruise_time = qMax(0.0,(length - (peak + vel)/2*acc_time - (peak + end_vel)/2*dec_time)/peak);
+        total_time += acc_time + cruise_time + dec_time;
+        speed_time += (peak + vel)/2*acc_time + peak*cruise_time + (peak + end_vel)/2*dec_time;
+        square_speed_time += (vel*vel + vel*peak + peak*peak)/3*acc_time + peak*peak*cruise_time
+                           + (end_vel*end_vel + end_vel*peak + peak*peak)/3*dec_time;
+        vel = end_vel;
+    }
+    speed_variance = 0;
+    if(total_time > 0)
+    {
+        double mean = speed_time/total_time;
+        speed_variance = qMax(0.0,square_speed_time/total_time - mean*mean);
+    }
+    return total_time*1000;
+}
@@ -0,0 +1,42 @@
+#ifndef DISPENSE_PATH_PLANNER_H
+#define DISPENSE_PATH_PLANNER_H
+
+#include <QVector>
+
+/*
+ * Offline planning of the dispense polyline before it is sent as curve
+ * segments. Nearly collinear vertices are merged within a tolerance, then
+ * the end speed of every segment is set by a look-ahead pass: the configured
+ * end speed capped by the corner speed from the direction change, limited by
+ * what the acceleration and jerk can reach or stop from over the neighbouring
+ * segments.
+ */
+class DispensePathPlanner
+{
+public:
+    struct Segment
+    {
+        Segment(){}
+        Segment(const QVector<double> &end, double max_vel, double end_vel):end(end),maxVel(max_vel),endVel(end_vel){}
+        QVector<double> end;
+        double maxVel = 0;
+        double endVel = 0;
+    };
+
+    //合并后的线段, source_index/source_offset为原线段所在的新线段和在其中的起始距离
+    static QVector<Segment> simplify(const QVector<double> &start, const QVector<Segment> &segments, double tolerance,
+                                     QVector<int> &source_index, QVector<double> &source_offset);
+    //endVel进入时为配置的终点速度, 作为上限
+    static void planSpeeds(const QVector<double> &start, QVector<Segment> &segments, double acc, double jerk,
+                           double corner_deviation);
+    static double estimateTime(const QVector<double> &start, const QVector<Segment> &segments, double acc, double &speed_variance);
+    static double distance(const QVector<double> &from, const QVector<double> &to);
+
+private:
+    static double distanceToLine(const QVector<double> &point, const QVector<double> &from, const QVector<double> &to);
+    static double cornerSpeed(const QVector<double> &from, const QVector<double> &corner, const QVector<double> &to,
+                              double acc, double corner_deviation);
+    static double reachableSpeed(double vel, double length, double acc, double jerk);
+};
+
+#endif // DISPENSE_PATH_PLANNER_H
@@ -88,100 +88,110 @@ bool Dispenser::Dispense(QVector<DispensePathPoint> &dispense_path)
         return false;
     }
 
-    double first_line_len=0;
-    for(int i=0; i<dispense_path.length(); i++)
+    //按下发顺序列出线段, 闭合路径最后回到第一点并再走一次第一条线用于关胶
+    int path_count = dispense_path.length();
+    QVector<DispensePathPlanner::Segment> segments;
+    for(int i=0; i<path_count; i++)
+        segments.append(DispensePathPlanner::Segment(dispense_path[i].p, getMaxSpeed(i), getEndSpeed(i)));
+    int open_segment = path_count > 1 ? 1 : -1;
+    int close_segment = -1;
+    if(path_count > 2)
+    {
+        segments.append(DispensePathPlanner::Segment(dispense_path[0].p, getMaxSpeed(path_count), getEndSpeed(path_count)));
+        segments.append(DispensePathPlanner::Segment(dispense_path[1].p, getMaxSpeed(0), getEndSpeed(0)));
+        close_segment = segments.length() - 1;
+    }
+
+    //前瞻规划: 合并近似共线的点并重算每段终点速度, 开关胶触发点映射到合并后的线段
+    QVector<DispensePathPlanner::Segment> planned_segments = segments;
+    QVector<int> source_index;
+    QVector<double> source_offset;
+    for(int i=0; i<segments.length(); i++)
+    {
+        source_index.append(i);
+        source_offset.append(0);
+    }
+    if(parameters.lookAhead())
+    {
+        double path_acc = axis_max_acc[0], path_jerk = axis_max_jerk[0];
+        for(int i = 1; i<dem; i++)
+        {
+            path_acc = qMin(path_acc, axis_max_acc[i]);
+            path_jerk = qMin(path_jerk, axis_max_jerk[i]);
+        }
+        planned_segments = DispensePathPlanner::simplify(dispense_path[0].p, segments, parameters.pathTolerance(), source_index, source_offset);
+        DispensePathPlanner::planSpeeds(dispense_path[0].p, planned_segments, path_acc, path_jerk, parameters.cornerDeviation());
+        double variance, planned_variance;
+        double time = DispensePathPlanner::estimateTime(dispense_path[0].p, segments, path_acc, variance);
+        double planned_time = DispensePathPlanner::estimateTime(dispense_path[0].p, planned_segments, path_acc, planned_variance);
+        qInfo("Dispense look ahead segments %d -> %d, estimated time %f -> %f ms, speed variance %f -> %f",
+              segments.length(), planned_segments.length(), time, planned_time, variance, planned_variance);
+    }
+
+    double first_line_len = 0;
+    for(int i=0; i<planned_segments.length(); i++)
     {
-        res = XT_Controler_Extend::Append_Line_Pos(curve_id, dem, axis.data(), dispense_path[i].p.data(),
-                                                   getMaxSpeed(i), getEndSpeed(i), 0, nPoint_Index);
-        qInfo("point %d : %f,%f",i, dispense_path[i].p.data()[0],dispense_path[i].p.data()[1]);
+        res = XT_Controler_Extend::Append_Line_Pos(curve_id, dem, axis.data(), planned_segments[i].end.data(),
+                                                   planned_segments[i].maxVel, planned_segments[i].endVel, 0, nPoint_Index);
+        qInfo("point %d : %f,%f end speed %f",i, planned_segments[i].end[0],planned_segments[i].end[1],planned_segments[i].endVel);
         if(1!=res)
         {
             qInfo("error in adding No%d point!",i);
             state = DISPENSER_ERROR;
             return false;
         }
-//        if(i!=0 && dispense_path[i].type != PATH_POINT_LINE)
-//        {
-//            int value=0;
-//            if(dispense_path[i].type == PATH_POINT_OPEN_VALVE)
-//                value =1;
-//            else if(dispense_path[i].type == PATH_POINT_CLOSE_VALVE)
-//                value = 0;
-//            res = XT_Controler_Extend::Set_Cur_Trig_Output(curve_id, 1, -output_distence_offset, output_time_offset / 1000, valve_output_id, value);
-//        }
-        if(i==1)
+        if(open_segment > 0 && source_index[open_segment] == i)
         {
-            first_line_len = XT_Controler_Extend::Curve_Get_LengthPos(curve_id,nPoint_Index);
+            //合并后第一条线不再是单独的曲线段, 只能按两点距离计算
+            if(parameters.lookAhead())
+                first_line_len = DispensePathPlanner::distance(dispense_path[0].p, dispense_path[1].p);
+            else
+                first_line_len = XT_Controler_Extend::Curve_Get_LengthPos(curve_id,nPoint_Index);
             qInfo("first_line_len is %f",first_line_len);
             double half_len = first_line_len/2.0;
             if(parameters.openOffset()>half_len)
             {
                 qInfo("%f Too BIG, set to %f",parameters.openOffset(),half_len);
                 parameters.setOpenOffset(half_len);
-
             }
             if(parameters.openOffset()<-half_len)
             {
                 qInfo("%f Too SMALL, set to %f",parameters.openOffset(),-half_len);
                 parameters.setOpenOffset(-half_len);
             }
-            res = XT_Controler_Extend::Set_Cur_Trig_Output(curve_id, 0, first_line_len/2+parameters.openOffset(), 0, output_io->GetID(), 1);
-            qInfo("point:%d length:%f offset:%f",i,first_line_len, first_line_len/2+parameters.openOffset());
+            double open_position = source_offset[open_segment] + first_line_len/2+parameters.openOffset();
+            res = XT_Controler_Extend::Set_Cur_Trig_Output(curve_id, 0, open_position, 0, output_io->GetID(), 1);
             if(1!=res)
             {
                 qInfo("error in adding IO open In No%d point!",i);
                 state = DISPENSER_ERROR;
                 return false;
             }
-            qInfo("Dispenser Open Position Set To %f", first_line_len/2+parameters.openOffset());
+            qInfo("Dispenser Open Position Set To %f", open_position);
         }
-        if((i==dispense_path.length()-1)&&(i>1))
+        if(close_segment > 0 && source_index[close_segment] == i)
         {
-            res = XT_Controler_Extend::Append_Line_Pos(curve_id, dem, axis.data(), dispense_path[0].p.data(),
-                                                       getMaxSpeed(i+1), getEndSpeed(i+1), 0, nPoint_Index);
-            qInfo("point end0%d : %f,%f,%f",i, dispense_path[0].p.data()[0],dispense_path[0].p.data()[1],dispense_path[0].p.data()[2]);
-            if(1!=res)
-            {
-                qInfo("error in adding No%d point!",i+1);
-                state = DISPENSER_ERROR;
-                return false;
-            }
-            res = XT_Controler_Extend::Append_Line_Pos(curve_id, dem, axis.data(), dispense_path[1].p.data(),
-                                                       getMaxSpeed(0),getEndSpeed(0), 0, nPoint_Index);
-            qInfo("point end1%d : %f,%f,%f",i, dispense_path[1].p.data()[0],dispense_path[1].p.data()[1],dispense_path[1].p.data()[2]);
-            if(1!=res)
-            {
-                qInfo("error in adding No%d point!",i+2);
-                state = DISPENSER_ERROR;
-                return false;
-            }
-
             double half_len = first_line_len/2.0;
             if(parameters.closeOffset()>half_len)
             {
-
                 qInfo("%f Too BIG, set to %f",parameters.closeOffset(),half_len);
                 parameters.setCloseOffset(half_len);
-
             }
             if(parameters.closeOffset()<-half_len)
             {
                 qInfo("%f Too SMALL, set to %f",parameters.closeOffset(),-half_len);
                 parameters.setCloseOffset(-half_len);
             }
-
-            res = XT_Controler_Extend::Set_Cur_Trig_Output(curve_id, 0, first_line_len/2+parameters.closeOffset(), 0, output_io->GetID(), 0);
-            qInfo("point:%d length:%f offset:%f",i,first_line_len, first_line_len/2+parameters.closeOffset());
+            double close_position = source_offset[close_segment] + first_line_len/2+parameters.closeOffset();
+            res = XT_Controler_Extend::Set_Cur_Trig_Output(curve_id, 0, close_position, 0, output_io->GetID(), 0);
             if(1!=res)
             {
                 qInfo("error in adding IO close In No%d point!",i);
                 state = DISPENSER_ERROR;
                 return false;
             }
-            qInfo("Dispenser Close Position Set To %f", first_line_len/2+parameters.closeOffset());
+            qInfo("Dispenser Close Position Set To %f", close_position);
         }
-
-
     }
     XT_Controler::SGO(thread_curve,axis[2],0);
     XT_Controler::TILLSTOP(thread_curve,axis[2]);
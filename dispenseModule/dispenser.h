@@ -1,5 +1,6 @@
 #ifndef DISPENSER_H
 #define DISPENSER_H
+#include "dispenseModule/dispense_path_planner.h"
 #include "dispenseModule/dispenser_parameter.h"
 #include "xtmotor.h"
 
@@ -19,6 +19,9 @@ public:
     Q_PROPERTY(QString dispenseIo READ dispenseIo WRITE setDispenseIo NOTIFY DispenseIoChanged)
     Q_PROPERTY(QString glueLevelCheckIO READ glueLevelCheckIO WRITE setGlueLevelCheckIO NOTIFY glueLevelCheckIOChanged)
     Q_PROPERTY(bool enableGlueLevelCheck READ enableGlueLevelCheck WRITE setEnableGlueLevelCheck NOTIFY glueLevelCheckChanged)
+    Q_PROPERTY(bool lookAhead READ lookAhead WRITE setLookAhead NOTIFY lookAheadChanged)
+    Q_PROPERTY(double pathTolerance READ pathTolerance WRITE setPathTolerance NOTIFY pathToleranceChanged)
+    Q_PROPERTY(double cornerDeviation READ cornerDeviation WRITE setCornerDeviation NOTIFY cornerDeviationChanged)
 //    Q_PROPERTY(double theta READ theta WRITE setTheta NOTIFY ThetaChanged)
     double openOffset() const
     {
@@ -69,6 +72,21 @@ public:
         return m_enableGlueLevelCheck;
     }
 
+    bool lookAhead() const
+    {
+        return m_lookAhead;
+    }
+
+    double pathTolerance() const
+    {
+        return m_pathTolerance;
+    }
+
+    double cornerDeviation() const
+    {
+        return m_cornerDeviation;
+    }
+
 public slots:
     void setOpenOffset(double openOffset)
     {
@@ -181,6 +199,33 @@ public slots:
         emit glueLevelCheckChanged(m_enableGlueLevelCheck);
     }
 
+    void setLookAhead(bool lookAhead)
+    {
+        if (m_lookAhead == lookAhead)
+            return;
+
+        m_lookAhead = lookAhead;
+        emit lookAheadChanged(m_lookAhead);
+    }
+
+    void setPathTolerance(double pathTolerance)
+    {
+        if (qFuzzyCompare(m_pathTolerance, pathTolerance))
+            return;
+
+        m_pathTolerance = pathTolerance;
+        emit pathToleranceChanged(m_pathTolerance);
+    }
+
+    void setCornerDeviation(double cornerDeviation)
+    {
+        if (qFuzzyCompare(m_cornerDeviation, cornerDeviation))
+            return;
+
+        m_cornerDeviation = cornerDeviation;
+        emit cornerDeviationChanged(m_cornerDeviation);
+    }
+
 signals:
     void openOffsetChanged(double openOffset);
 
@@ -210,6 +255,12 @@ signals:
 
     void glueLevelCheckChanged(bool enableGlueLevelCheck);
 
+    void lookAheadChanged(bool lookAhead);
+
+    void pathToleranceChanged(double pathTolerance);
+
+    void cornerDeviationChanged(double cornerDeviation);
+
 private:
     double m_openOffset = 0;
     double m_closeOffset = 0;
@@ -221,6 +272,9 @@ private:
     int m_speedCount = 0;
     QString m_glueLevelCheckIO = "Glue_Level_Check_IO";
     bool m_enableGlueLevelCheck = false;
+    bool m_lookAhead = false;
+    double m_pathTolerance = 0.005;
+    double m_cornerDeviation = 0.01;
 };
 
 #endif // DISPENSER_PARAMETER_H
@@ -1,4 +1,5 @@
 ﻿#include "lensloadermodule.h"
+#include "cycletracerecorder.h"
 #include "tcpmessager.h"
 
 LensLoaderModule::LensLoaderModule(QString name):ThreadWorkerBase (name)
@@ -158,7 +159,7 @@ void LensLoaderModule::run(bool has_material)
         if(states.hasTray()&&(!states.allowChangeTray())&&states.hasPickedNgLens())
         {
             has_task = true;
-            vacancy_vision->OpenLight();
+            vacancy_vision->PreOpenLight();
             int result_tray = 0;
             if(!moveToTrayEmptyPos(states.pickerLensData()["LensId"].toInt(),states.pickerLensData()["TrayId"].toInt(),result_tray))
             {
@@ -239,7 +240,7 @@ void LensLoaderModule::run(bool has_material)
             {
                 sendMessageToModule("LensTrayLoaderModule","ReadyTrayResquest");
             }
-            lens_vision->OpenLight();
+            lens_vision->PreOpenLight();
             if(!moveToNextTrayPos(states.currentTray()))
             {
                 int alarm_id = sendAlarmMessage(CONTINUE_RETRY_OPERATION,GetCurrentError());
@@ -336,6 +337,7 @@ void LensLoaderModule::run(bool has_material)
                     states.setHasTray(true);
                     tray->resetTrayState(0);
                     tray->resetTrayState(1);
+                    last_pr_tray_id = -1;
                     states.setCurrentTray(0);
                     states.setNeedChangTray(false);
                     states.setAllowChangeTray(false);
@@ -413,7 +415,7 @@ void LensLoaderModule::run(bool has_material)
         {
             addCurrentNgNumber();
             has_task = true;
-            lut_lens_vision->OpenLight();
+            lut_lens_vision->PreOpenLight();
             if(!moveToLUTPRPos2())
             {
                 int alarm_id = sendAlarmMessage(CONTINUE_RETRY_OPERATION,GetCurrentError());
@@ -487,6 +489,7 @@ void LensLoaderModule::run(bool has_material)
 bool LensLoaderModule::moveToNextTrayPos(int tray_index)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     qInfo("moveToNextTrayPos:%d",tray_index);
     bool result = false;
     pick_arm->setCallerName(__FUNCTION__);
@@ -512,6 +515,7 @@ bool LensLoaderModule::moveToLUTPRPos1(bool check_softlanding)
 bool LensLoaderModule::movePickerToLUTPos1(bool check_arrived,bool check_softlanding)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QString temp;
     pick_arm->setCallerName(__FUNCTION__);
     bool result =  pick_arm->move_XYT_Synic(lut_pr_position1.X() + camera_to_picker_offset.X(),lut_pr_position1.Y() + camera_to_picker_offset.Y(),parameters.placeTheta(),check_arrived,check_softlanding);
@@ -529,6 +533,7 @@ bool LensLoaderModule::movePickerToLUTPos1(bool check_arrived,bool check_softlan
 bool LensLoaderModule::moveToLUTPRPos2(bool check_softlanding)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QString temp;
     if(parameters.openTimeLog())
         qInfo("moveToLUTPRPos2 check_softlanding %d",check_softlanding);
@@ -569,8 +574,14 @@ bool LensLoaderModule::checkNeedChangeTray()
 bool LensLoaderModule::performLensPR()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     qInfo("performLensPR");
     bool result;
+    if(last_pr_tray_id != states.currentTray())
+    {
+        lens_vision->resetSearchPrediction();
+        last_pr_tray_id = states.currentTray();
+    }
     if(states.runMode() == RunMode::NoMaterial)
         result= lens_vision->performNoMaterialPR();
     else
@@ -586,6 +597,7 @@ bool LensLoaderModule::performLensPR()
 bool LensLoaderModule::performVacancyPR()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     qInfo("performVacancyPR");
     bool result;
     if(states.runMode() == RunMode::NoMaterial)
@@ -635,6 +647,7 @@ bool LensLoaderModule::performLUTNGSlotPR()
 bool LensLoaderModule::performLUTLensPR()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     qInfo("performLUTLensPR");
     bool result;
     if(states.runMode() == RunMode::NoMaterial)
@@ -680,6 +693,7 @@ bool LensLoaderModule::performUpdowlookUpPR(PrOffset &offset)
 bool LensLoaderModule:: moveToWorkPos(bool check_state)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     PrOffset temp(camera_to_picker_offset.X() - pr_offset.X,camera_to_picker_offset.Y() - pr_offset.Y,-pr_offset.Theta);
     pick_arm->setCallerName(__FUNCTION__);
     bool result = pick_arm->stepMove_XYTp_Pos(temp,false);
@@ -772,6 +786,7 @@ bool LensLoaderModule::vcmSearchReturn()
 bool LensLoaderModule::pickTrayLens()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QString temp;
     qInfo("pickTrayLens");
     double dist_z = fabs(pick_arm->picker->motor_z->GetFeedbackPos() - parameters.pickLensZ());
@@ -796,6 +811,7 @@ bool LensLoaderModule::pickTrayLens()
 bool LensLoaderModule::placeLensToLUT()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     if(parameters.openTimeLog())
@@ -852,6 +868,7 @@ bool LensLoaderModule::pickLUT1Lens()
 bool LensLoaderModule::pickLUTLens()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     bool result = vcmSearchLUTZ(parameters.placeLensZ(), true);
@@ -878,6 +895,7 @@ bool LensLoaderModule::pickLUTLens()
 bool LensLoaderModule::placeLensToTray()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QString temp;
     pick_arm->setCallerName(__FUNCTION__);
     bool result =  vcmSearchZ(parameters.pickLensZ(),false);
@@ -915,6 +933,7 @@ bool LensLoaderModule::measureHight(bool is_tray)
 bool LensLoaderModule::moveToTrayEmptyPos(int index, int tray_index,int& result_tray)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QString temp;
     qInfo("moveToTrayEmptyPos index %d tray_index %d",index,tray_index);
     result_tray = tray_index;
@@ -1330,14 +1349,14 @@ void LensLoaderModule::performHandlingOperation(int cmd,QVariant param)
     {
         this->unloadAllLens();
         sendAlarmMessage(OK_OPERATION,"Lens Clearance Done",ErrorLevel::TipNonblock);
-        is_handling = false;
+        finishHandling();
         return;
     }
     if (cmd == HandleMarcoAction::LOAD_ONE_LENS_TO_LUT)
     {
         this->loadOneLensToLUT();
         sendAlarmMessage(OK_OPERATION,"Load lens to LUT Done",ErrorLevel::TipNonblock);
-        is_handling = false;
+        finishHandling();
         return;
     }
     if(cmd%temp_value == HandlePosition::LUT_POS1)
@@ -1365,7 +1384,7 @@ void LensLoaderModule::performHandlingOperation(int cmd,QVariant param)
     if(!result)
     {
         sendAlarmMessage(OK_OPERATION,GetCurrentError(),ErrorLevel::TipNonblock);
-        is_handling = false;
+        finishHandling();
         return;
     }
     if(cmd%temp_value == HandlePR::RESET_PR)
@@ -1387,7 +1406,7 @@ void LensLoaderModule::performHandlingOperation(int cmd,QVariant param)
     if(!result)
     {
         sendAlarmMessage(OK_OPERATION,GetCurrentError(),ErrorLevel::TipNonblock);
-        is_handling = false;
+        finishHandling();
         return;
     }
     cmd =cmd/temp_value*temp_value;
@@ -1402,7 +1421,7 @@ void LensLoaderModule::performHandlingOperation(int cmd,QVariant param)
     if(!result)
     {
         sendAlarmMessage(OK_OPERATION,GetCurrentError(),ErrorLevel::TipNonblock);
-        is_handling = false;
+        finishHandling();
         return;
     }
     cmd =cmd/temp_value*temp_value;
@@ -1464,10 +1483,10 @@ void LensLoaderModule::performHandlingOperation(int cmd,QVariant param)
     if(!result)
     {
         sendAlarmMessage(OK_OPERATION,GetCurrentError(),ErrorLevel::TipNonblock);
-        is_handling = false;
+        finishHandling();
         return;
     }
-    is_handling = false;
+    finishHandling();
 }
 
 QString LensLoaderModule::getUuid(bool is_right, int current_count, int current_time)
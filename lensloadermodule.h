@@ -187,6 +187,7 @@ private:
     bool debug = false;
     ErrorLevel error_level;
     PrOffset pr_offset;
+    int last_pr_tray_id = -1;
 
     QTime time_label;
 
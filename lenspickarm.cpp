@@ -1,4 +1,5 @@
 #include "lenspickarm.h"
+#include "cycletracerecorder.h"
 
 LensPickArm::LensPickArm(QString name):ErrorBase (name)
 {
@@ -34,6 +35,7 @@ bool LensPickArm::move_XtXY_Synic(QPointF position,double x,bool check_softlandi
 bool LensPickArm::move_XtXYT_Synic(QPointF position, double x, double t, bool check_softlanding, int timeout)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     if(check_softlanding)if(!picker->motor_z->resetSoftLanding(timeout))return false;
@@ -92,6 +94,7 @@ bool LensPickArm::checkXYTArrived(double x, double y, double t)
 bool LensPickArm::move_XYT_Synic(double x, double y, double t,bool check_arrived, bool check_softlanding, int timeout)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     double dist_x = fabs(motor_x->GetFeedbackPos() - x);
@@ -144,6 +147,7 @@ bool LensPickArm::stepMove_XYTp_Synic(PrOffset position,bool check_softlanding,i
 bool LensPickArm::stepMove_XYTp_Pos(PrOffset position, bool check_softlanding, int timeout)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     if(check_softlanding)if(!picker->motor_z->resetSoftLanding(timeout))return false;
@@ -216,6 +220,7 @@ bool LensPickArm::ZSerchByForce(double speed, double force,bool check_softlandin
 bool LensPickArm::ZSerchByForce(double speed, double force, double limit, double margin,int finish_time,bool open_vacuum, bool need_z_return, int timeout)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     bool result = picker->motor_z->SearchPosByForce(speed,force,limit,margin, timeout);
@@ -238,14 +238,12 @@ void LogicManager::sendLogicManangerName()
 
 bool LogicManager::waitReturnMessage()
 {
+    QMutexLocker temp_locker(&return_mutex);
     while (is_handling) {
         if(return_message.contains("performHandlingResp"))
-        {
-            bool result = return_message["performHandlingResp"].toBool();
-            return_message.remove("performHandlingResp");
-            return result;
-        }
-        Sleep(10);
+            return return_message.take("performHandlingResp").toBool();
+        //is_handling的变化没有通知, 限时等待后重新检查
+        return_received.wait(&return_mutex,200);
     }
     return false;
 }
@@ -1419,8 +1417,10 @@ void LogicManager::receiveMessageFromWorkerManger(QVariantMap message)
     if(message.contains("performHandlingResp"))
     {
         qInfo("receiveMessageFromWorkerManger performHandlingResp %d",message["performHandlingResp"].toBool());
+        QMutexLocker temp_locker(&return_mutex);
         if(!return_message.contains("performHandlingResp"))
             return_message.insert("performHandlingResp",message["performHandlingResp"].toBool());
+        return_received.wakeAll();
     }
     else
     {
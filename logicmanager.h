@@ -4,7 +4,9 @@
 #include "basemodulemanager.h"
 #include "logicmanagerparameter.h"
 
+#include <QMutex>
 #include <QThread>
+#include <QWaitCondition>
 #include <utils/unitlog.h>
 //模块联动
 
@@ -247,6 +249,8 @@ private:
     bool is_handling = false;
     bool result;
     QVariantMap  return_message;
+    QMutex return_mutex;
+    QWaitCondition return_received;
 protected:
     void run();
 private:
@@ -1,4 +1,5 @@
 ﻿#include "lutModule/lut_module.h"
+#include "cycletracerecorder.h"
 #include "utils/commonutils.h"
 #include "materialtray.h"
 #include <tcpmessager.h>
@@ -117,6 +118,9 @@ void LutModule::receiveLoadLensRequstFinish(int lens, int lens_tray)
     qInfo("LutModule set has lens");
     qInfo("LutModule loaded lens id: %d tray id: %d", lens, lens_tray);
     states.setFinishWaitLens(true);
+    QMutexLocker message_locker(&message_mutex);
+    task_notified = true;
+    notifyEvent(TASK_EVENT);
 }
 
 void LutModule::run(bool has_material)
@@ -124,26 +128,34 @@ void LutModule::run(bool has_material)
     qInfo("Start Lut Module Thread");
     is_run = true;
     bool has_task = true;
+    bool has_action = true;
+    QElapsedTimer action_timer;
     time_label = QTime::currentTime();
+    dispatch_clock.start();
     while(is_run){
-        QThread::msleep(10);
+        //有动作后立即检查下一步, 空闲时等待AA请求或上料完成的通知
+        if(!has_action)
+        {
+            QMutexLocker temp_locker(&message_mutex);
+            waitEvent(TASK_EVENT,[this](){return task_notified;},is_run,parameters.priorityDispatch()?EVENT_RECHECK_INTERVAL:10);
+            task_notified = false;
+        }
+        has_action = false;
         //分配任务
         if(states.busyState() == BusyState::IDLE)
         {
-            if(states.station1HasRequest())
-            {
-                states.setBusyState(BusyState::STATION1);
-                states.setLastState(states.busyState());
-            }
-            else if(states.station2HasRequest())
+            int station = selectStation();
+            if(station != BusyState::IDLE)
             {
-                states.setBusyState(BusyState::STATION2);
+                states.setBusyState(station);
                 states.setLastState(states.busyState());
             }
         }
-        //AA1卸NG料
-        if((!states.waitingLens())&&(states.busyState() == BusyState::STATION1)&&(states.aa1HeadMaterialState() == MaterialState::IsNgLens)&&(!states.lutHasNgLens()))
+        //AA1卸NG料, 优先调度时等LUT取到新镜头再卸, 卸料和上料一趟完成
+        if((!states.waitingLens())&&(states.busyState() == BusyState::STATION1)&&(states.aa1HeadMaterialState() == MaterialState::IsNgLens)&&(!states.lutHasNgLens())
+                &&(!(parameters.priorityDispatch()&&(!states.lutHasLens())&&states.station1NeedLens())))
         {
+            action_timer.start();
             if(!moveToAA1UnPickLens())
             {
                 int alarm_id = sendAlarmMessage(CONTINUE_RETRY_OPERATION,GetCurrentError());
@@ -155,10 +167,14 @@ void LutModule::run(bool has_material)
             states.setLutHasNgLens(true);
             states.setAa1HeadMaterialState(MaterialState::IsEmpty);
             states.copyInNgLensData(states.aa1LensData());
+            updateEstimate(unload_estimate,action_timer.elapsed());
+            has_action = true;
         }
-        //AA2卸NG料
-        if((!states.waitingLens())&&(states.busyState() == BusyState::STATION2)&&(states.aa2HeadMaterialState() == MaterialState::IsNgLens)&&(!states.lutHasNgLens()))
+        //AA2卸NG料, 优先调度时等LUT取到新镜头再卸, 卸料和上料一趟完成
+        if((!states.waitingLens())&&(states.busyState() == BusyState::STATION2)&&(states.aa2HeadMaterialState() == MaterialState::IsNgLens)&&(!states.lutHasNgLens())
+                &&(!(parameters.priorityDispatch()&&(!states.lutHasLens())&&states.station2NeedLens())))
         {
+            action_timer.start();
             if(!moveToAA2UnPickLens())
             {
                 int alarm_id = sendAlarmMessage(CONTINUE_RETRY_OPERATION,GetCurrentError());
@@ -170,6 +186,8 @@ void LutModule::run(bool has_material)
             states.setLutHasNgLens(true);
             states.setAa2HeadMaterialState(MaterialState::IsEmpty);
             states.copyInNgLensData(states.aa2LensData());
+            updateEstimate(unload_estimate,action_timer.elapsed());
+            has_action = true;
         }
         //AA1上料
         if((!states.waitingLens())&&(states.busyState() == BusyState::STATION1)&&(states.aa1HeadMaterialState() == MaterialState::IsEmpty)&&states.station1NeedLens()&&states.lutHasLens())
@@ -187,6 +205,7 @@ void LutModule::run(bool has_material)
                 else if(RETRY_OPERATION == operation)
                     continue;
             }
+            action_timer.start();
             if(!moveToAA1PickLens())
             {
                 int alarm_id = sendAlarmMessage(CONTINUE_RETRY_OPERATION,GetCurrentError());
@@ -199,6 +218,8 @@ void LutModule::run(bool has_material)
             states.setStation1NeedLens(false);
             states.setAa1HeadMaterialState(MaterialState::IsRawLens);
             states.copyInAa1LensData(states.lensData());
+            updateEstimate(pick_estimate,action_timer.elapsed());
+            has_action = true;
         }
         //AA2上料
         if((!states.waitingLens())&&(states.busyState() == BusyState::STATION2)&&(states.aa2HeadMaterialState() == MaterialState::IsEmpty)&&states.station2NeedLens()&&states.lutHasLens())
@@ -216,6 +237,7 @@ void LutModule::run(bool has_material)
                 else if(RETRY_OPERATION == operation)
                     continue;
             }
+            action_timer.start();
             if(!moveToAA2PickLens())
             {
                 int alarm_id = sendAlarmMessage(CONTINUE_RETRY_OPERATION,GetCurrentError());
@@ -228,10 +250,13 @@ void LutModule::run(bool has_material)
             states.setStation2NeedLens(false);
             states.setAa2HeadMaterialState(MaterialState::IsRawLens);
             states.copyInAa2LensData(states.lensData());
+            updateEstimate(pick_estimate,action_timer.elapsed());
+            has_action = true;
         }
         //AA1视觉
         if((!states.waitingLens())&&states.station1HasRequest()&&(!states.station1NeedLens())&&(states.aa1HeadMaterialState() != MaterialState::IsNgLens))
         {
+            action_timer.start();
             if((states.aa1HeadMaterialState() == MaterialState::IsRawLens)&&(!moveToAA1UplookPR()))
             {
                 int alarm_id = sendAlarmMessage(CONTINUE_RETRY_AUTOREJECT_REJECT_OPERATION,GetCurrentError());
@@ -258,10 +283,15 @@ void LutModule::run(bool has_material)
             param.insert("AAMaterialState",MaterialTray::getMaterialStateName(states.aa1HeadMaterialState()));
             param.insert("MaterialData",QJsonObject::fromVariantMap(states.aa1LensData()));
             sendMessageToModule("AA1CoreNew","FinishLoadLens",param);
+            if(states.aa1HeadMaterialState() == MaterialState::IsRawLens)
+                updateEstimate(pr_estimate,action_timer.elapsed());
+            finishStationRequest(0);
+            has_action = true;
         }
         //AA2视觉
         if((!states.waitingLens())&&states.station2HasRequest()&&(!states.station2NeedLens())&&(states.aa2HeadMaterialState() != MaterialState::IsNgLens))
         {
+            action_timer.start();
             if((states.aa2HeadMaterialState() == MaterialState::IsRawLens)&&(!moveToAA2UplookPR()))
             {
                 int alarm_id = sendAlarmMessage(CONTINUE_RETRY_AUTOREJECT_REJECT_OPERATION,GetCurrentError());
@@ -288,6 +318,10 @@ void LutModule::run(bool has_material)
             param.insert("AAMaterialState",MaterialTray::getMaterialStateName(states.aa2HeadMaterialState()));
             param.insert("MaterialData",QJsonObject::fromVariantMap(states.aa2LensData()));
             sendMessageToModule("AA2CoreNew","FinishLoadLens",param);
+            if(states.aa2HeadMaterialState() == MaterialState::IsRawLens)
+                updateEstimate(pr_estimate,action_timer.elapsed());
+            finishStationRequest(1);
+            has_action = true;
         }
         //请求上下料
         if((!states.waitingLens())&&(states.lutHasNgLens()||checkNeedLens()))
@@ -326,6 +360,8 @@ void LutModule::run(bool has_material)
 
             states.setWaitingLens(true);
             states.setWaitingTask(false);
+            lens_wait_timer.start();
+            has_action = true;
         }
         //无任务无料去等料位置
         if((!states.lutHasLens())&&(!checkNeedLens())&&(!states.lutHasNgLens()))
@@ -383,6 +419,8 @@ void LutModule::run(bool has_material)
             }
             states.setWaitingLens(false);
             states.setFinishWaitLens(false);
+            updateEstimate(lens_wait_estimate,lens_wait_timer.elapsed());
+            has_action = true;
         }
     }
     states.setRunMode(RunMode::Normal);
@@ -489,7 +527,7 @@ void LutModule::performHandlingOperation(int cmd,QVariant param)
 {
     if(is_run)
     {
-        is_handling = false;
+        finishHandling();
         return;
     }
     qInfo("Lut Module perform command: %d", cmd);
@@ -523,7 +561,7 @@ void LutModule::performHandlingOperation(int cmd,QVariant param)
     if(!result)
     {
         sendAlarmMessage(OK_OPERATION,GetCurrentError(),ErrorLevel::TipNonblock);
-        is_handling = false;
+        finishHandling();
         return;
     }
     //Handle PR
@@ -535,7 +573,7 @@ void LutModule::performHandlingOperation(int cmd,QVariant param)
     if(!result)
     {
         sendAlarmMessage(OK_OPERATION,GetCurrentError(),ErrorLevel::TipNonblock);
-        is_handling = false;
+        finishHandling();
         return;
     }
     //Action
@@ -577,10 +615,10 @@ void LutModule::performHandlingOperation(int cmd,QVariant param)
     if(!result)
     {
         sendAlarmMessage(OK_OPERATION,GetCurrentError(),ErrorLevel::TipNonblock);
-        is_handling = false;
+        finishHandling();
         return;
     }
-    is_handling = false;
+    finishHandling();
 }
 
 void LutModule::resetLogic()
@@ -589,7 +627,7 @@ void LutModule::resetLogic()
     states.reset();
 }
 
-void LutModule::Init(MaterialCarrier *carrier, VisionLocation* uplook_location,VisionLocation* load_location,VisionLocation* mushroom_location, XtVacuum *load_vacuum, XtVacuum *unload_vacuum,XtGeneralOutput *gripper, SutModule *sut,int check_thread)
+void LutModule::Init(MaterialCarrier *carrier, VisionLocation* uplook_location,VisionLocation* load_location,VisionLocation* mushroom_location, XtVacuum *load_vacuum, XtVacuum *unload_vacuum,XtGeneralOutput *gripper, SutModule *sut,int check_thread,XtGeneralInput *gripper_input)
 {
     this->carrier = carrier;
     parts.append(carrier);
@@ -606,6 +644,7 @@ void LutModule::Init(MaterialCarrier *carrier, VisionLocation* uplook_location,V
     this->sut = sut;
     this->check_thread = check_thread;
     this->gripper = gripper;
+    this->gripper_input = gripper_input;
     //Align some parameters name in lut params for the ease of access
     if (load_vacuum)
     {
@@ -678,6 +717,7 @@ bool LutModule::moveToAA1UplookPos(bool check_autochthonous,bool check_softlandi
 bool LutModule::moveToAA1UplookPR(PrOffset &offset, bool close_lighting,bool check_autochthonous,bool check_softlanding)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     qInfo("moveToAA1UplookPR");
@@ -706,6 +746,7 @@ bool LutModule::moveToAA1UplookPR(PrOffset &offset, bool close_lighting,bool che
 bool LutModule::moveToAA1UplookPR(bool close_lighting, bool check_autochthonous,bool check_softlanding)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     qInfo("moveToAA1UplookPR");
     PrOffset pr_offset;
     if(moveToAA1UplookPR(pr_offset,close_lighting,check_autochthonous, check_softlanding))
@@ -734,6 +775,7 @@ bool LutModule::moveToAA2UplookPos(bool check_autochthonous,bool check_softlandi
 bool LutModule::moveToAA2UplookPR(PrOffset &offset, bool close_lighting,bool check_autochthonous,bool check_softlanding)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     uplook_location->OpenLight();
@@ -760,6 +802,7 @@ bool LutModule::moveToAA2UplookPR(PrOffset &offset, bool close_lighting,bool che
 bool LutModule::moveToAA2UplookPR(bool close_lighting, bool check_autochthonous,bool check_softlanding)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     qInfo("moveToAA2UplookPR");
     PrOffset pr_offset;
     if(moveToAA2UplookPR(pr_offset,close_lighting,check_autochthonous,check_softlanding))
@@ -787,18 +830,33 @@ bool LutModule::moveToLoadPos(bool check_autochthonous,bool check_softlanding)
 bool LutModule::moveToLoadPosAndCheckMaterial(bool has_lens,bool has_ng_lens,bool check_autochthonous,bool check_softlanding)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
-    bool result = load_vacuum->checkHasMateriel(check_thread);
+    bool result = true;
+    //运动交给运动执行器, 移动过程中检查吸真空
+    XtMotionHandle move_handle;
+    if(!(check_autochthonous&&carrier->CheckXYZArrived(load_position.X(),load_position.Y(),load_position.Z())))
+    {
+        if(check_softlanding)
+            result = carrier->motor_z->resetSoftLanding(3000);
+        if(result)
+            move_handle = carrier->Move_SZ_SY_X_Y_Z_Async(load_position.X(),load_position.Y(),load_position.Z());
+    }
+    temp.append(" submit_move ").append(QString::number(smallTimer.elapsed()));
+    smallTimer.restart();
+    result &= load_vacuum->checkHasMateriel(check_thread);
     temp.append(" load_vacuum_checkHasMateriel ").append(QString::number(smallTimer.elapsed()));
     smallTimer.restart();
     result &= unload_vacuum->checkHasMateriel(check_thread);
     temp.append(" unload_vacuum_checkHasMateriel ").append(QString::number(smallTimer.elapsed()));
     smallTimer.restart();
-    carrier->setCallerFunctionName(__FUNCTION__);
-    result &= carrier->Move_SZ_SY_X_Y_Z_Sync(load_position.X(),load_position.Y(),load_position.Z(),check_autochthonous,check_softlanding);
-    carrier->setCallerFunctionName("");
-    temp.append(" Move_SZ_SY_X_Y_Z_Sync ").append(QString::number(smallTimer.elapsed()));
+    if(move_handle.isValid()&&!move_handle.wait())
+    {
+        AppendError(QString(u8"LUT移动到上料位置失败: %1").arg(move_handle.errorMessage()));
+        result = false;
+    }
+    temp.append(" wait_move ").append(QString::number(smallTimer.elapsed()));
     smallTimer.restart();
     result &=  waitLutLensCheckResult(has_lens);
     temp.append(" waitLutLensCheckResult ").append(QString::number(smallTimer.elapsed()));
@@ -854,6 +912,7 @@ double LutModule::getLoadUplookPRY()
 bool LutModule::moveToAA1PickLens(bool need_return,bool check_autochthonous,bool check_softlanding)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
 
@@ -896,7 +955,7 @@ bool LutModule::moveToAA1PickLens(bool need_return,bool check_autochthonous,bool
         result &= closeLoadVacuum();
         temp.append(" closeLoadVacuum ").append(QString::number(smallTimer.elapsed()));
         smallTimer.restart();
-        Sleep(parameters.gripperDelay());
+        waitGripperConfirm(true);
         temp.append(" delay ").append(QString::number(smallTimer.elapsed()));
         if(need_return)
         {
@@ -935,7 +994,7 @@ bool LutModule::moveToAA1PickLensFromPocket2(bool need_return, bool check_autoch
         }
         closeAA1Griper();
         result &= closeLoadVacuum();
-        Sleep(parameters.gripperDelay());
+        waitGripperConfirm(true);
         if(need_return)
             result &= carrier->ZSerchReturn();
     }
@@ -981,6 +1040,7 @@ bool LutModule::moveToAA1UnPickLensPos(bool check_autochthonous, bool check_soft
 bool LutModule::moveToAA1UnPickLens(bool check_autochthonous,bool check_softlanding)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     carrier->setCallerFunctionName(__FUNCTION__);
@@ -997,7 +1057,7 @@ bool LutModule::moveToAA1UnPickLens(bool check_autochthonous,bool check_softland
         result &= openUnloadVacuum();
         temp.append(" openUnloadVacuum ").append(QString::number(smallTimer.elapsed()));
         smallTimer.restart();
-        Sleep(parameters.gripperDelay());
+        waitGripperConfirm(true);
         temp.append(" gripperDelay ").append(QString::number(smallTimer.elapsed()));
         smallTimer.restart();
         result &= carrier->ZSerchReturn();
@@ -1019,7 +1079,7 @@ bool LutModule::moveToAA1UnPickLensFromPocket1(bool check_autochthonous, bool ch
         result = carrier->motor_z->SearchPosByForce(parameters.pickSpeed(),parameters.pickForce(),aa1_picklens_position.Z(),parameters.lensHeight());
         openAA1Griper();
         result &= openUnloadVacuum();
-        Sleep(parameters.gripperDelay());
+        waitGripperConfirm(true);
         result &= carrier->ZSerchReturn();
     }
     return result;
@@ -1033,6 +1093,7 @@ bool LutModule::moveToAA2PickLensPos(bool check_autochthonous,bool check_softlan
 bool LutModule::moveToAA2PickLens(bool need_return, bool check_autochthonous,bool check_softlanding)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     qInfo("moveToAA2PickLens");
@@ -1070,7 +1131,7 @@ bool LutModule::moveToAA2PickLens(bool need_return, bool check_autochthonous,boo
         result &= closeLoadVacuum();
         temp.append(" closeLoadVacuum ").append(QString::number(smallTimer.elapsed()));
         smallTimer.restart();
-        Sleep(parameters.gripperDelay());
+        waitGripperConfirm(false);
         temp.append(" closeLoadVacuum ").append(QString::number(smallTimer.elapsed()));
         if(need_return){
             smallTimer.restart();
@@ -1111,7 +1172,7 @@ bool LutModule::moveToAA2PickLensFromPocket2(bool need_return, bool check_autoch
         }
         closeAA2Griper();
         result &= closeLoadVacuum();
-        Sleep(parameters.gripperDelay());
+        waitGripperConfirm(false);
         if(need_return)
             result &= carrier->ZSerchReturn();
     }
@@ -1126,6 +1187,7 @@ bool LutModule::moveToAA2UnPickLensPos(bool check_autochthonous, bool check_soft
 bool LutModule::moveToAA2UnPickLens(bool check_autochthonous,bool check_softlanding)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     qInfo("moveToAA2UnPickLens Start to aa2 unpickLens");
@@ -1147,7 +1209,7 @@ bool LutModule::moveToAA2UnPickLens(bool check_autochthonous,bool check_softland
         result &= openUnloadVacuum();
         temp.append(" openUnloadVacuum ").append(QString::number(smallTimer.elapsed()));
         smallTimer.restart();
-        Sleep(parameters.gripperDelay());
+        waitGripperConfirm(false);
         temp.append(" gripperDelay ").append(QString::number(smallTimer.elapsed()));
         smallTimer.restart();
         result &= carrier->motor_z->resetSoftLanding();
@@ -1173,7 +1235,7 @@ bool LutModule::moveToAA2UnPickLensFromPocket1(bool check_autochthonous, bool ch
         qInfo("moveToAA2UnPickLens Finish ZSerchByForce");
         openAA2Griper();
         result &= openUnloadVacuum();
-        Sleep(parameters.gripperDelay());
+        waitGripperConfirm(false);
         result &= carrier->motor_z->resetSoftLanding();
     }
     return result;
@@ -1204,6 +1266,7 @@ bool LutModule::moveToAA2ReturnPos(bool check_autochthonous,bool check_softlandi
 bool LutModule::moveToAA1ReadyPos(bool check_autochthonous,bool check_softlanding)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     qInfo("moveToAA1readyPos(%f,%f,%f)",aa1_unpicklens_position.X(),0,0);
     carrier->setCallerFunctionName(__FUNCTION__);
     bool ret = carrier->Move_SZ_SY_X_Y_Z_Sync(aa1_unpicklens_position.X(),0,0,check_autochthonous,check_softlanding);
@@ -1215,6 +1278,7 @@ bool LutModule::moveToAA1ReadyPos(bool check_autochthonous,bool check_softlandin
 bool LutModule::moveToAA2ReadyPos(bool check_autochthonous,bool check_softlanding)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     qInfo("moveToAA2readyPos(%f,%f,%f)",aa2_unpicklens_position.X(),0,0);
     carrier->setCallerFunctionName(__FUNCTION__);
     bool ret = carrier->Move_SZ_SY_X_Y_Z_Sync(aa2_unpicklens_position.X(),0,0,check_autochthonous,check_softlanding);
@@ -1226,6 +1290,7 @@ bool LutModule::moveToAA2ReadyPos(bool check_autochthonous,bool check_softlandin
 bool LutModule::checkLutLensSync(bool check_state)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     if(!has_material) {
         qWarning("[Timelog] %s %d", __FUNCTION__, timer.elapsed());
         return true;
@@ -1371,6 +1436,69 @@ bool LutModule::checkNeedLens()
     return true;
 }
 
+int LutModule::selectStation()
+{
+    bool has_request1 = states.station1HasRequest();
+    bool has_request2 = states.station2HasRequest();
+    if((!parameters.priorityDispatch())||(!has_request1)||(!has_request2))
+    {
+        if(has_request1)
+            return BusyState::STATION1;
+        if(has_request2)
+            return BusyState::STATION2;
+        return BusyState::IDLE;
+    }
+    //两个AA都在等时, 先服务预计最快完成的, 已等的时间越长越优先
+    double keys[2];
+    {
+        QMutexLocker temp_locker(&message_mutex);
+        qint64 now = dispatch_clock.elapsed();
+        for (int i = 0; i < 2; ++i)
+            keys[i] = estimateService(i) - (request_times[i] >= 0?now - request_times[i]:0);
+    }
+    int station = keys[1] < keys[0]?BusyState::STATION2:BusyState::STATION1;
+    qInfo("LUT dispatch station1 key %.0f station2 key %.0f select %d",keys[0],keys[1],station);
+    return station;
+}
+
+double LutModule::estimateService(int station)
+{
+    int head_state = station == 0?states.aa1HeadMaterialState():states.aa2HeadMaterialState();
+    bool need_lens = station == 0?states.station1NeedLens():states.station2NeedLens();
+    bool has_ng_lens = head_state == MaterialState::IsNgLens;
+    double time = 0;
+    //LUT上已有NG料或没有镜头时要先去上料位换料
+    if((has_ng_lens&&states.lutHasNgLens())||(need_lens&&(!states.lutHasLens())))
+        time += lens_wait_estimate;
+    if(has_ng_lens)
+        time += unload_estimate;
+    if(need_lens)
+        time += pick_estimate + pr_estimate;
+    else if(head_state == MaterialState::IsRawLens)
+        time += pr_estimate;
+    return time;
+}
+
+void LutModule::updateEstimate(double &estimate, qint64 elapsed)
+{
+    //包含报警等待的时间不计入
+    if(elapsed <= 0||elapsed > 30000)
+        return;
+    estimate = estimate*0.8 + elapsed*0.2;
+}
+
+void LutModule::finishStationRequest(int station)
+{
+    QMutexLocker temp_locker(&message_mutex);
+    if(request_times[station] < 0)
+        return;
+    qint64 idle = dispatch_clock.elapsed() - request_times[station];
+    request_times[station] = -1;
+    idle_sums[station] += idle;
+    served_counts[station]++;
+    qInfo("LUT serve station%d head idle %lld ms average %.1f ms",station + 1,idle,double(idle_sums[station])/served_counts[station]);
+}
+
 void LutModule::aa2HeadMoveToPickPos()
 {
     sendMessageToModule("LogicManager2","AAHeadMoveToPickPos");
@@ -1419,6 +1547,22 @@ bool LutModule::waitGripermFinish()
     return false;
 }
 
+void LutModule::waitGripperConfirm(bool local_gripper)
+{
+    //AA2夹爪在远端, 没有本地反馈时仍按固定延时
+    if((!local_gripper)||gripper == nullptr||gripper_input == nullptr||states.runMode() == RunMode::NoMaterial)
+    {
+        Sleep(parameters.gripperDelay());
+        return;
+    }
+    bool target_state = parameters.gripperInputInvert()?(!gripper->Value()):gripper->Value();
+    int elapsed = 0;
+    if(gripper_input->WaitStable(target_state,parameters.gripperDebounce(),parameters.gripperDelay(),&elapsed))
+        qInfo("gripper confirmed in %d ms, saved %d ms",elapsed,parameters.gripperDelay() - elapsed - parameters.gripperDebounce());
+    else
+        qWarning("gripper input %s not confirmed in %d ms",gripper_input->Name().toStdString().c_str(),parameters.gripperDelay());
+}
+
 QString LutModule::getUuid(bool is_right, int current_count, int current_time)
 {
     QString uuid = "";
@@ -1483,6 +1627,7 @@ void LutModule::receivceModuleMessage(QVariantMap message)
                 if(!states.station1Unload())
                     states.setStation1NeedLens(true);
                 states.setStation1HasRequest(true);
+                request_times[0] = dispatch_clock.isValid()?dispatch_clock.elapsed():-1;
             }
             else if(message["Message"].toString()=="UnloadMode")
             {
@@ -1513,6 +1658,7 @@ void LutModule::receivceModuleMessage(QVariantMap message)
                 if(!states.station2Unload())
                     states.setStation2NeedLens(true);
                 states.setStation2HasRequest(true);
+                request_times[1] = dispatch_clock.isValid()?dispatch_clock.elapsed():-1;
             }
             else if(message["Message"].toString()=="UnloadMode")
             {
@@ -1547,6 +1693,9 @@ void LutModule::receivceModuleMessage(QVariantMap message)
             }
         }
     }
+    //receivceModuleMessageBase已持有message_mutex
+    task_notified = true;
+    notifyEvent(TASK_EVENT);
 }
 
 PropertyBase *LutModule::getModuleState()
@@ -10,6 +10,7 @@
 #include "vision/vision_location.h"
 #include "network/sparrowqserver.h"
 #include <QObject>
+#include <QElapsedTimer>
 #include <QQueue>
 #include "thread_worker_base.h"
 #include "sutModule/sut_module.h"
@@ -66,7 +67,8 @@ public:
     explicit LutModule(QString name = "LUTModule", QObject * parent = nullptr);
     void Init(MaterialCarrier* carrier,
               VisionLocation* uplook_location,VisionLocation* load_location,VisionLocation* mushroom_location,
-              XtVacuum* load_vacuum, XtVacuum* unload_vacuum,XtGeneralOutput* gripper, SutModule* sut,int check_thread);
+              XtVacuum* load_vacuum, XtVacuum* unload_vacuum,XtGeneralOutput* gripper, SutModule* sut,int check_thread,
+              XtGeneralInput* gripper_input = nullptr);
     void loadJsonConfig(QString file_name);
     void saveJsonConfig(QString file_name);
     void openServer(int port);
@@ -118,6 +120,7 @@ private:
     VisionLocation* load_location;
     VisionLocation* mushroom_location;
     XtGeneralOutput* gripper;
+    XtGeneralInput* gripper_input = nullptr;
     QMutex loader_mutext;
     SparrowQServer * server;
     QMutex tcp_mutex;
@@ -133,6 +136,22 @@ private:
 
     void run(bool has_material);
 //    void runTest();
+    //调度
+    int selectStation();
+    double estimateService(int station);
+    void updateEstimate(double &estimate, qint64 elapsed);
+    void finishStationRequest(int station);
+    const QString TASK_EVENT = "LutTask";
+    bool task_notified = false;
+    QElapsedTimer dispatch_clock;
+    qint64 request_times[2] = {-1,-1};
+    qint64 idle_sums[2] = {0,0};
+    int served_counts[2] = {0,0};
+    double unload_estimate = 1500;
+    double pick_estimate = 2000;
+    double pr_estimate = 1000;
+    double lens_wait_estimate = 4000;
+    QElapsedTimer lens_wait_timer;
     bool isActionEmpty();
     QString servingIP = "";
     void sendEvent(const QString event);
@@ -198,6 +217,7 @@ public:
     void openAA2Griper();
     void closeAA2Griper();
     bool waitGripermFinish();
+    void waitGripperConfirm(bool local_gripper);
     //真空操作
     bool openLoadVacuum();
     bool closeLoadVacuum();
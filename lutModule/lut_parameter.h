@@ -33,6 +33,10 @@ public:
     Q_PROPERTY(QString tcpLutVacuum2Name READ tcpLutVacuum2Name WRITE setTcpLutVacuum2Name NOTIFY tcpLutVacuumSensor2Changed)
     Q_PROPERTY(QString tcpLutVacuumSensor1Name READ tcpLutVacuumSensor1Name WRITE setTcpLutVacuumSensor1Name NOTIFY tcpLutVacuumSensor1NameChanged)
     Q_PROPERTY(QString tcpLutVacuumSensor2Name READ tcpLutVacuumSensor2Name WRITE setTcpLutVacuumSensor2Name NOTIFY tcpLutVacuumSensor2NameChanged)
+    Q_PROPERTY(bool priorityDispatch READ priorityDispatch WRITE setPriorityDispatch NOTIFY priorityDispatchChanged)
+    Q_PROPERTY(QString gripperInputName READ gripperInputName WRITE setGripperInputName NOTIFY gripperInputNameChanged)
+    Q_PROPERTY(bool gripperInputInvert READ gripperInputInvert WRITE setGripperInputInvert NOTIFY gripperInputInvertChanged)
+    Q_PROPERTY(int gripperDebounce READ gripperDebounce WRITE setGripperDebounce NOTIFY gripperDebounceChanged)
     double pickForce() const
     {
         return m_PickForce;
@@ -158,6 +162,26 @@ public:
         return m_placeSpeed;
     }
 
+    bool priorityDispatch() const
+    {
+        return m_priorityDispatch;
+    }
+
+    QString gripperInputName() const
+    {
+        return m_gripperInputName;
+    }
+
+    bool gripperInputInvert() const
+    {
+        return m_gripperInputInvert;
+    }
+
+    int gripperDebounce() const
+    {
+        return m_gripperDebounce;
+    }
+
     int placeGripperDelay() const
     {
         return m_placeGripperDelay;
@@ -394,6 +418,42 @@ public slots:
         emit placeGripperDelayChanged(m_placeGripperDelay);
     }
 
+    void setPriorityDispatch(bool priorityDispatch)
+    {
+        if (m_priorityDispatch == priorityDispatch)
+            return;
+
+        m_priorityDispatch = priorityDispatch;
+        emit priorityDispatchChanged(m_priorityDispatch);
+    }
+
+    void setGripperInputName(QString gripperInputName)
+    {
+        if (m_gripperInputName == gripperInputName)
+            return;
+
+        m_gripperInputName = gripperInputName;
+        emit gripperInputNameChanged(m_gripperInputName);
+    }
+
+    void setGripperInputInvert(bool gripperInputInvert)
+    {
+        if (m_gripperInputInvert == gripperInputInvert)
+            return;
+
+        m_gripperInputInvert = gripperInputInvert;
+        emit gripperInputInvertChanged(m_gripperInputInvert);
+    }
+
+    void setGripperDebounce(int gripperDebounce)
+    {
+        if (m_gripperDebounce == gripperDebounce)
+            return;
+
+        m_gripperDebounce = gripperDebounce;
+        emit gripperDebounceChanged(m_gripperDebounce);
+    }
+
 signals:
     void paramsChanged();
 
@@ -448,6 +508,14 @@ signals:
 
     void placeGripperDelayChanged(int placeGripperDelay);
 
+    void priorityDispatchChanged(bool priorityDispatch);
+
+    void gripperInputNameChanged(QString gripperInputName);
+
+    void gripperInputInvertChanged(bool gripperInputInvert);
+
+    void gripperDebounceChanged(int gripperDebounce);
+
 private:
     double m_PickForce = 0;
     QString m_motorXName = "LUT_X";
@@ -475,6 +543,10 @@ private:
     double m_placeForce = 0;
     double m_placeSpeed = 10;
     int m_placeGripperDelay = 500;
+    bool m_priorityDispatch = false;
+    QString m_gripperInputName = "";
+    bool m_gripperInputInvert = false;
+    int m_gripperDebounce = 10;
 };
 
 class LutState:public PropertyBase
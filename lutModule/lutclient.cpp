@@ -6,20 +6,128 @@ LutClient::LutClient(AAHeadModule * aaHead, QString address, QObject *parent) :
 {
     socketClient = new SparrowClient(QUrl(address),  true);
     this->aaHead = aaHead;
+    state_timer.start();
     connect(socketClient, &SparrowClient::receiveMessage, this, &LutClient::receiveMessage);
     connect(this, &LutClient::sendMessageToServer, this->socketClient, &SparrowClient::sendMessage);
 }
 
-bool LutClient::waitLensRespond(bool &is_run)
+LutClient::StateLimit LutClient::stateLimit(LutClientState state)
+{
+    //只有可重复的请求才重发; LUT可能在服务另一工位或换盘, 要料请求重发会重复排队
+    switch (state) {
+    case WAITING_LENS_PICK_EVENT:
+        return StateLimit{120000,0};
+    case WAITING_LENS_PR_EVENT:
+        return StateLimit{20000,0};
+    case WAITING_LUT_LEAVE_EVENT:
+        return StateLimit{10000,0};
+    case WAITING_LUT_OPERATION_ACK_EVENT:
+        return StateLimit{60000,1};
+    default:
+        return StateLimit{0,0};
+    }
+}
+
+void LutClient::setState(LutClientState new_state)
+{
+    //调用者持有state_mutex
+    if(new_state != state)
+        qInfo("Lut Client state %d -> %d after %lld ms", state, new_state, state_timer.elapsed());
+    state = new_state;
+    state_timer.restart();
+    retry_count = 0;
+    state_changed.wakeAll();
+}
+
+QString LutClient::responseEvent(const QString &cmd)
+{
+    //xxxReq的回复是xxxResp
+    return cmd.left(cmd.length() - 3) + "Resp";
+}
+
+void LutClient::dropExpectedEvent(int count)
+{
+    //调用者持有state_mutex
+    if(expected_event.isEmpty())
+        return;
+    stale_responses[expected_event] += count;
+    expected_event.clear();
+}
+
+bool LutClient::acceptEvent(const QString &event)
+{
+    //调用者持有state_mutex; 服务端按顺序回复, 旧请求的回复先到
+    if(stale_responses.value(event) > 0)
+    {
+        stale_responses[event]--;
+        qWarning("Lut Client ignore stale %s in state %d", event.toStdString().c_str(), state);
+        return false;
+    }
+    if(event != expected_event)
+    {
+        qWarning("Lut Client ignore unexpected %s in state %d, waiting %s", event.toStdString().c_str(), state, expected_event.toStdString().c_str());
+        return false;
+    }
+    //重发过的请求还会再回复
+    dropExpectedEvent(retry_count);
+    return true;
+}
+
+void LutClient::sendRequest(LutClientState new_state, const QJsonObject &request)
 {
-    while (this->state != LutClientState::LUT_CLIENT_IDLE)
+    QString jsonString = getStringFromJsonObject(request);
+    {
+        QMutexLocker locker(&state_mutex);
+        //未完成的请求不再等待
+        dropExpectedEvent(retry_count + 1);
+        expected_event = responseEvent(request["cmd"].toString());
+        last_request = jsonString;
+        exchange_fail = false;
+        setState(new_state);
+    }
+    emit sendMessageToServer(jsonString);
+}
+
+bool LutClient::waitIdle(const bool &is_run)
+{
+    QMutexLocker locker(&state_mutex);
+    while (state != LutClientState::LUT_CLIENT_IDLE)
     {
         if(!is_run)
             return false;
-        //qInfo("Waiting LUT ....");
-        QThread::msleep(10);
+        StateLimit limit = stateLimit(state);
+        qint64 left = limit.timeout - state_timer.elapsed();
+        if(left <= 0)
+        {
+            if(retry_count >= limit.retry)
+            {
+                qWarning("Lut Client state %d timeout %d ms after %d retry", state, limit.timeout, retry_count);
+                exchange_fail = true;
+                dropExpectedEvent(retry_count + 1);
+                setState(LutClientState::LUT_CLIENT_IDLE);
+                break;
+            }
+            int temp_retry = retry_count + 1;
+            QString request = last_request;
+            qWarning("Lut Client state %d timeout %d ms, resend %s", state, limit.timeout, request.toStdString().c_str());
+            state_timer.restart();
+            retry_count = temp_retry;
+            locker.unlock();
+            emit sendMessageToServer(request);
+            locker.relock();
+            continue;
+        }
+        //运行标志的变化没有通知, 最长200ms重新检查
+        state_changed.wait(&state_mutex, ulong(qMin(left, qint64(200))));
     }
-    return this->state == LutClientState::LUT_CLIENT_IDLE;
+    return !exchange_fail;
+}
+
+bool LutClient::waitLensRespond(bool &is_run)
+{
+    bool result = waitIdle(is_run);
+    qInfo("Lut Client lens exchange %s round trip %lld ms", result?"finish":"fail", exchange_timer.elapsed());
+    return result;
 }
 
 void LutClient::receiveMessage(QString message)
@@ -28,12 +136,20 @@ void LutClient::receiveMessage(QString message)
     qInfo("Lut Client receive message: %s", message.toStdString().c_str());
     QString event = json["event"].toString("");
     QString cmd = json["cmd"].toString("");
+    if (!event.isEmpty()) {
+        //不是当前请求的回复时不改变状态也不运动
+        QMutexLocker locker(&state_mutex);
+        if (!acceptEvent(event))
+            event.clear();
+    }
     QJsonObject obj;
+    LutClientState next_state = LutClientState::LUT_CLIENT_IDLE;
     bool isValid = false;
+    bool isEvent = !event.isEmpty();
     if (event == "lensResp") {
         isValid = true;
         qInfo("AA Head need to pick lens");
-        this->state = LutClientState::WAITING_LENS_PR_EVENT;
+        next_state = LutClientState::WAITING_LENS_PR_EVENT;
         if(has_ng_lens)
         {
             qInfo("aa unpick ng lens");
@@ -46,10 +162,12 @@ void LutClient::receiveMessage(QString message)
         }
     } else if (event == "unpickNgLensResp") {
         isValid = true;
+        next_state = LutClientState::WAITING_LENS_PR_EVENT;
         qInfo("aa pick lens");
         obj.insert("cmd", "pickLensReq");
     }else if (event == "pickLensResp") {
         isValid = true;
+        next_state = LutClientState::WAITING_LENS_PR_EVENT;
         aaHead->moveToMushroomPosition();
         qInfo("LUT move to load lens position");
         qInfo("perform pickedLens pr");
@@ -62,40 +180,36 @@ void LutClient::receiveMessage(QString message)
         double prOffsetY = json["prOffsetY"].toDouble(0);
         qInfo("PR Result...offsetX %f offsetY %f offsetT %f", prOffsetX, prOffsetY, prOffsetT);
         aaHead->receiveLensFromLut(prOffsetX, prOffsetY, prOffsetT);
-        this->state = LutClientState::WAITING_LUT_LEAVE_EVENT;
+        next_state = LutClientState::WAITING_LUT_LEAVE_EVENT;
     } else if (event == "lutLeaveResp") {
         qInfo("LUT move to load lens position");
-        this->state = LutClientState::LUT_CLIENT_IDLE;
-        return;
     } else if (event == "moveToUnloadPosResp") {
         qInfo("LUT move to unload position");
-        this->state = LutClientState::LUT_CLIENT_IDLE;
     } else if (event == "moveToAA1UplookPosResp") {
         qInfo("LUT move to AA1 uplook position");
-        this->state = LutClientState::LUT_CLIENT_IDLE;
     } else if (event == "moveToAA2UplookPosResp") {
         qInfo("LUT move to AA2 uplook position");
-        this->state = LutClientState::LUT_CLIENT_IDLE;
     } else if (event == "tooluplookPRResp") {
         qInfo("LUT tooluplook PR Resp");
         double prOffsetT = json["prOffsetT"].toDouble(0);
         double prOffsetX = json["prOffsetX"].toDouble(0);
         double prOffsetY = json["prOffsetY"].toDouble(0);
-        tempPrResult.X = prOffsetX; tempPrResult.Y = prOffsetY; tempPrResult.Theta = prOffsetT;
         qInfo("PR Result...offsetX %f offsetY %f offsetT %f", prOffsetX, prOffsetY, prOffsetT);
-        this->state = LutClientState::LUT_CLIENT_IDLE;
+        QMutexLocker locker(&state_mutex);
+        tempPrResult.X = prOffsetX; tempPrResult.Y = prOffsetY; tempPrResult.Theta = prOffsetT;
     }
     if (cmd == "gripperOnReq") {
         qInfo("AA Gripper On Request");
         aaHead->openGripper();
-        QThread::msleep(200);
     } else if (cmd == "gripperOffReq") {
         qInfo("AA Gripper Of Request");
         aaHead->closeGripper();
     }
     if (isValid) {
-        QString jsonString = getStringFromJsonObject(obj);
-        emit sendMessageToServer(jsonString);
+        sendRequest(next_state, obj);
+    } else if (isEvent) {
+        QMutexLocker locker(&state_mutex);
+        setState(next_state);
     }
 }
 
@@ -105,10 +219,9 @@ bool LutClient::sendLensRequest(bool has_ng_lens)
     this->has_ng_lens = has_ng_lens;
     QJsonObject obj;
     obj.insert("cmd", "lensReq");
-    QString jsonString = getStringFromJsonObject(obj);
-    this->state = LutClientState::WAITING_LENS_PICK_EVENT;
+    exchange_timer.start();
     qInfo("ready to sendMessageToServer");
-    emit sendMessageToServer(jsonString);
+    sendRequest(LutClientState::WAITING_LENS_PICK_EVENT, obj);
     return true;
 }
 
@@ -123,18 +236,10 @@ bool LutClient::sendLUTMoveToPos(int type)
         obj.insert("cmd", "moveToAA1UplookPosReq");
     else if (type == 2)
         obj.insert("cmd", "moveToAA2UplookPosReq");
-    QString jsonString = getStringFromJsonObject(obj);
-    this->state = LutClientState::WAITING_LENS_PICK_EVENT;
-    emit sendMessageToServer(jsonString);
-    int timeout = 60;
-    while (timeout>0 && this->state != LutClientState::LUT_CLIENT_IDLE)
-    {
-        timeout--;
-        qInfo("Waiting LUT ....");
-        QThread::msleep(1000);
-    }
-    if (timeout == 0) {
-        qInfo("Lut Client send move to unload position timeout. current state = %d", this->state);
+    sendRequest(LutClientState::WAITING_LUT_OPERATION_ACK_EVENT, obj);
+    bool is_run = true;
+    if (!waitIdle(is_run)) {
+        qInfo("Lut Client send move to pos %d timeout", type);
         return false;
     }
     return true;
@@ -142,24 +247,20 @@ bool LutClient::sendLUTMoveToPos(int type)
 
 bool LutClient::requestToolUpPRResult(PrOffset &offset)
 {
-    tempPrResult.X = 0; tempPrResult.Y = 0; tempPrResult.Theta = 0;
+    {
+        QMutexLocker locker(&state_mutex);
+        tempPrResult.X = 0; tempPrResult.Y = 0; tempPrResult.Theta = 0;
+    }
     qInfo("LUT Client request Tool Uplook PRResult");
     QJsonObject obj;
     obj.insert("cmd", "tooluplookPRReq");
-    QString jsonString = getStringFromJsonObject(obj);
-    this->state = LutClientState::WAITING_LENS_PICK_EVENT;
-    emit sendMessageToServer(jsonString);
-    int timeout = 60;
-    while (timeout>0 && this->state != LutClientState::LUT_CLIENT_IDLE)
-    {
-        timeout--;
-        qInfo("Waiting PR Result ....");
-        QThread::msleep(1000);
-    }
-    if (timeout == 0) {
-        qInfo("Lut Client send move to unload position timeout. current state = %d", this->state);
+    sendRequest(LutClientState::WAITING_LUT_OPERATION_ACK_EVENT, obj);
+    bool is_run = true;
+    if (!waitIdle(is_run)) {
+        qInfo("Lut Client request tool uplook PR timeout");
         return false;
     }
+    QMutexLocker locker(&state_mutex);
     offset = tempPrResult;
     return true;
 }
@@ -2,6 +2,10 @@
 #define LUTCLIENT_H
 
 #include <QObject>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMutex>
+#include <QWaitCondition>
 #include "network/sparrowqclient.h"
 #include "aaHeadModule/aaheadmodule.h"
 #include "utils/pixel2mech.h"
@@ -13,6 +17,16 @@ enum LutClientState{
     WAITING_LUT_OPERATION_ACK_EVENT
 };
 
+/*
+ * AA side of the remote LUT lens protocol. Every server event moves the
+ * state machine in receiveMessage and wakes the waiting caller at once.
+ * Each state has its own timeout. LUT moves and the tool uplook PR are safe
+ * to repeat and are resent once before giving up; a timeout anywhere in the
+ * lens exchange fails it, since a repeated lens request would queue twice.
+ * Every exchange logs its round trip and the time spent in each state.
+ * Only the response to the outstanding request is handled; answers to
+ * resent or abandoned requests are counted and dropped when they arrive.
+ */
 class LutClient : public QObject
 {
     Q_OBJECT
@@ -24,7 +38,29 @@ public:
     bool requestToolUpPRResult(PrOffset &prOffset);
     bool isLutClientConnected();
 private:
-    LutClientState state;
+    struct StateLimit
+    {
+        int timeout;
+        int retry;
+    };
+    StateLimit stateLimit(LutClientState state);
+    void setState(LutClientState new_state);
+    void sendRequest(LutClientState new_state, const QJsonObject &request);
+    bool waitIdle(const bool &is_run);
+    QString responseEvent(const QString &cmd);
+    bool acceptEvent(const QString &event);
+    void dropExpectedEvent(int count);
+
+    LutClientState state = LUT_CLIENT_IDLE;
+    QMutex state_mutex;
+    QWaitCondition state_changed;
+    QElapsedTimer state_timer;
+    QElapsedTimer exchange_timer;
+    QString last_request;
+    QString expected_event;
+    QHash<QString,int> stale_responses;     //已重发或放弃的请求还会收到的回复数
+    int retry_count = 0;
+    bool exchange_fail = false;
     SparrowClient * socketClient;
     AAHeadModule * aaHead;
     PrOffset tempPrResult;
@@ -1,4 +1,6 @@
 #include "material_carrier.h"
+#include "cycletracerecorder.h"
+#include "xtstatesnapshot.h"
 #include <QElapsedTimer>
 
 MaterialCarrier::MaterialCarrier():ErrorBase ()
@@ -30,8 +32,10 @@ bool MaterialCarrier::CheckXYDistanceBigger(double x, double y, double check_dis
 
 bool MaterialCarrier::Move_SZ_XY_Z_Sync(double x, double y, double z, int timeout)
 {
+    if(parameters.BlendMove())
+        return Move_SZ_XY_Z_Blend(x,y,z,timeout);
     bool result;
-    result = motor_z->MoveToPosSync(parameters.SafetyZ());
+    result = MoveZToSafety();
     if(!result) return false;
     motor_x->MoveToPos(x);
     motor_y->MoveToPos(y);
@@ -42,9 +46,66 @@ bool MaterialCarrier::Move_SZ_XY_Z_Sync(double x, double y, double z, int timeou
     return result;
 }
 
+bool MaterialCarrier::Move_SZ_XY_Z_Blend(double x, double y, double z, int timeout)
+{
+    QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
+    double safety_z = parameters.SafetyZ();
+    double start_x = motor_x->GetFeedbackPos();
+    double start_y = motor_y->GetFeedbackPos();
+    double start_z = motor_z->GetFeedbackPos();
+    //分段等待到位时的估算耗时
+    double sequential_time = EstimateMoveTime(motor_z,fabs(start_z - safety_z))
+                           + qMax(EstimateMoveTime(motor_x,fabs(start_x - x)),EstimateMoveTime(motor_y,fabs(start_y - y)))
+                           + EstimateMoveTime(motor_z,fabs(safety_z - z));
+    bool result = MoveZToClearance(x,y);
+    if(!result) return false;
+    //每次下发都按其它轴的当前位置和目标位置做限位和干涉检查
+    result = motor_x->MoveToPos(x);
+    result &= motor_y->MoveToPos(y);
+    if(!result) return false;
+    result = motor_x->WaitArrivedTargetPos(x,parameters.BlendXYDistance(),timeout);
+    result &= motor_y->WaitArrivedTargetPos(y,parameters.BlendXYDistance(),timeout);
+    if(!result) return false;
+    result = motor_z->MoveToPos(z);
+    if(!result) return false;
+    result = motor_x->WaitArrivedTargetPos(x,timeout);
+    result &= motor_y->WaitArrivedTargetPos(y,timeout);
+    //Z的等待时间与MoveToPosSync一致
+    result &= motor_z->WaitArrivedTargetPos(z,Z_MOVE_TIMEOUT);
+    qInfo("[Timelog] %s:%s %lld sequential_estimate %.0f saved %.0f",callerName.toStdString().c_str(),__FUNCTION__,
+          timer.elapsed(),sequential_time,sequential_time - timer.elapsed());
+    return result;
+}
+
+XtMotionHandle MaterialCarrier::Move_SZ_XY_Z_Async(double x, double y, double z, int timeout)
+{
+    //三段分开提交, XY和Z下降的干涉检查在上一段到位后才做
+    XtMotionHandle handle = XtMotionExecutor::instance()->submit(XtMotionSequence().moveAndWait(motor_z,parameters.SafetyZ()),timeout);
+    handle = handle.then(XtMotionSequence().move(motor_x,x).move(motor_y,y).waitStop(motor_x).waitStop(motor_y),timeout);
+    return handle.then(XtMotionSequence().moveAndWait(motor_z,z),timeout);
+}
+
+XtMotionHandle MaterialCarrier::Move_SZ_SY_X_Y_Z_Async(double x, double y, double z, double check_distance, int timeout)
+{
+    //与Move_SZ_SY_X_Y_Z_Sync同样的顺序, 每段到位后才提交下一段
+    XtMotionExecutor *executor = XtMotionExecutor::instance();
+    XtMotionHandle handle;
+    if(CheckXYDistanceBigger(x,y,check_distance))
+    {
+        handle = executor->submit(XtMotionSequence().moveAndWait(motor_z,parameters.SafetyZ()),handle,timeout);
+        if(fabs(x - motor_x->GetFeedbackPos()) > check_distance)
+            handle = executor->submit(XtMotionSequence().moveAndWait(motor_y,parameters.SafetyY()),handle,timeout);
+    }
+    handle = executor->submit(XtMotionSequence().moveAndWait(motor_x,x),handle,timeout);
+    handle = executor->submit(XtMotionSequence().moveAndWait(motor_y,y),handle,timeout);
+    return executor->submit(XtMotionSequence().moveAndWait(motor_z,z),handle,timeout);
+}
+
 bool MaterialCarrier::Move_SZ_SX_Y_X_Z_Sync(double x, double y, double z,bool check_autochthonous,bool check_softlanding,double check_distance, int timeout)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     if (check_softlanding)
@@ -59,7 +120,7 @@ bool MaterialCarrier::Move_SZ_SX_Y_X_Z_Sync(double x, double y, double z,bool ch
     {
         double dist_z = fabs( motor_z->GetFeedbackPos() - parameters.SafetyZ());
         smallTimer.restart();
-        result = motor_z->MoveToPosSync(parameters.SafetyZ());
+        result = MoveZToSafety();
         temp.append(" dist_z ").append(QString::number(dist_z))
             .append(" move_safety_z ").append(QString::number(smallTimer.elapsed()));
         if(!result) return false;
@@ -101,6 +162,7 @@ bool MaterialCarrier::Move_SZ_SX_Y_X_Z_Sync(double x, double y, double z,bool ch
 bool MaterialCarrier::Move_SZ_SX_Y_X_Sync(double x, double y, double y_error, bool check_autochthonous, bool check_softlanding, double check_distance, int timeout)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     if (check_softlanding)
@@ -162,7 +224,7 @@ bool MaterialCarrier::Move_SZ_SX_YS_X_Z_Sync(double x, double y, double z, bool
     bool result;
     if(CheckXYDistanceBigger(x,y,check_distance))
     {
-        result = motor_z->MoveToPosSync(parameters.SafetyZ());
+        result = MoveZToSafety();
         if(!result) return false;
         if(fabs(y - motor_y->GetFeedbackPos()) > check_distance)
         {
@@ -182,6 +244,7 @@ bool MaterialCarrier::Move_SZ_SX_YS_X_Z_Sync(double x, double y, double z, bool
 bool MaterialCarrier::Move_SZ_SY_X_Y_Z_Sync(double x, double y, double z,bool check_autochthonous,bool check_softlanding, double check_distance, int timeout)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     if (check_softlanding)
@@ -196,7 +259,7 @@ bool MaterialCarrier::Move_SZ_SY_X_Y_Z_Sync(double x, double y, double z,bool ch
     {
         double dist_z = fabs(motor_z->GetFeedbackPos() - parameters.SafetyZ());
         smallTimer.restart();
-        result = motor_z->MoveToPosSync(parameters.SafetyZ());
+        result = MoveZToSafety();
         temp.append(" dist_z ").append(QString::number(dist_z))
             .append(" move_z ").append(QString::number(smallTimer.elapsed()));
         if(!result) return false;
@@ -237,6 +300,7 @@ bool MaterialCarrier::Move_SZ_SY_X_Y_Z_Sync(double x, double y, double z,bool ch
 bool MaterialCarrier::Move_SZ_SY_X_YS_Z_Sync(double x, double y, double z, bool check_autochthonous, bool check_softlanding, double check_distance, int timeout)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     if (check_softlanding)
@@ -251,7 +315,7 @@ bool MaterialCarrier::Move_SZ_SY_X_YS_Z_Sync(double x, double y, double z, bool
     {
         double dist_z = fabs(motor_z->GetFeedbackPos() - parameters.SafetyZ());
         smallTimer.restart();
-        result = motor_z->MoveToPosSync(parameters.SafetyZ());
+        result = MoveZToSafety();
         temp.append(" dist_z ").append(QString::number(dist_z))
             .append(" move_safety_z ").append(QString::number(smallTimer.elapsed()));
         if(!result) return false;
@@ -292,7 +356,7 @@ bool MaterialCarrier::Move_SZ_SY_X_YS_Z_Sync(double x, double y, double z, bool
 bool MaterialCarrier::Move_SZ_XY_ToPos(double x, double y, int timeout)
 {
     bool result;
-    result = motor_z->MoveToPosSync(parameters.SafetyZ());
+    result = MoveZToSafety();
     if(!result) return false;
     motor_x->MoveToPos(x);
     motor_y->MoveToPos(y);
@@ -321,7 +385,7 @@ bool MaterialCarrier::StepMove_XY_Sync(double step_x, double step_y, int timeout
 
 bool MaterialCarrier::StepMove_SZ_XY_Sync(double step_x, double step_y, int timeout)
 {
-    if(!motor_z->MoveToPosSync(parameters.SafetyZ()))
+    if(!MoveZToSafety())
         return false;
     return StepMove_XY_Sync(step_x,step_y);
 }
@@ -371,6 +435,77 @@ bool MaterialCarrier::ZSerchReturn()
     return result;
 }
 
+bool MaterialCarrier::MoveZToSafety()
+{
+    return motor_z->MoveToPosSync(parameters.SafetyZ());
+}
+
+bool MaterialCarrier::MoveZToClearance(double x, double y)
+{
+    double safety_z = parameters.SafetyZ();
+    double clearance_z;
+    if(!GetXYClearanceZ(x,y,clearance_z))
+        return motor_z->MoveToPosSync(safety_z);
+    //干涉检查读的是状态快照, 按Z最大速度留出快照最大延时内的行程
+    double direction = safety_z >= motor_z->GetFeedbackPos()?1:-1;
+    clearance_z += direction*motor_z->GetMaxVel()*XtStateSnapshot::instance()->defaultAge()/1000;
+    if((safety_z - clearance_z)*direction <= 0)
+        return motor_z->MoveToPosSync(safety_z);
+    //Z进入允许区间后即返回, 剩余行程与XY运动重叠
+    if(!motor_z->MoveToPos(safety_z))
+        return false;
+    return motor_z->WaitArrivedTargetPos(safety_z,fabs(safety_z - clearance_z),Z_MOVE_TIMEOUT);
+}
+
+bool MaterialCarrier::GetXYClearanceZ(double x, double y, double &clearance_z)
+{
+    //XY轴的垂直限位中限制Z的条目: XY行程经过其运动区间时, Z必须在包含安全高度的允许区间内
+    //没有相关限位或安全高度不在允许区间内时返回false, 等Z完全到达安全高度
+    double safety_z = parameters.SafetyZ();
+    double direction = safety_z >= motor_z->GetFeedbackPos()?1:-1;
+    XtMotor *xy_motors[2] = {motor_x,motor_y};
+    double targets[2] = {x,y};
+    bool found = false;
+    for (int i = 0; i < 2; ++i) {
+        double start = xy_motors[i]->GetFeedbackPos();
+        foreach (VerticalLimitParameter *limit, xy_motors[i]->vertical_limit_parameters) {
+            if(limit->motorName() != motor_z->Name()||!limit->hasInterferenceWithMoveSpance(start,targets[i]))
+                continue;
+            QVariantList spance = limit->limitSpance();
+            bool contained = false;
+            for (int j = 0; j + 1 < spance.size()&&!contained; j += 2) {
+                double low = spance[j].toDouble();
+                double high = spance[j+1].toDouble();
+                if(low > safety_z||safety_z > high)
+                    continue;
+                contained = true;
+                double bound = direction > 0?low:high;
+                if(!found||(bound - clearance_z)*direction > 0)
+                    clearance_z = bound;
+                found = true;
+            }
+            if(!contained)
+            {
+                qWarning("%s safety z %f not in %s limit of %s",motor_z->Name().toStdString().c_str(),safety_z,
+                         motor_z->Name().toStdString().c_str(),xy_motors[i]->Name().toStdString().c_str());
+                return false;
+            }
+        }
+    }
+    return found;
+}
+
+double MaterialCarrier::EstimateMoveTime(const XtMotor *motor, double distance)
+{
+    double vel = motor->GetMaxVel();
+    double acc = motor->GetMaxAcc();
+    if(vel <= 0||acc <= 0)
+        return 0;
+    if(distance < vel*vel/acc)
+        return 2000*sqrt(distance/acc);
+    return 1000*(distance/vel + vel/acc);
+}
+
 mPoint3D MaterialCarrier::GetFeedBackPos()
 {
     return mPoint3D(motor_x->GetFeedbackPos(),motor_y->GetFeedbackPos(),motor_z->GetFeedbackPos());
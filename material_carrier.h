@@ -5,6 +5,7 @@
 #include "XtVcMotor.h"
 #include "material_carrier_parameter.h"
 #include "position_define.h"
+#include "xtmotionexecutor.h"
 #include "xtmotor.h"
 class MaterialCarrier:public ErrorBase
 {
@@ -24,10 +25,13 @@ public:
     bool CheckXYZArrived(double x,double y,double z);
     bool CheckXYDistanceBigger(double x,double y,double check_distance);
     bool Move_SZ_XY_Z_Sync(double x,double y,double z,int timeout = 3000);
+    bool Move_SZ_XY_Z_Blend(double x,double y,double z,int timeout = 3000);
+    XtMotionHandle Move_SZ_XY_Z_Async(double x,double y,double z,int timeout = 3000);
     bool Move_SZ_SX_Y_X_Z_Sync(double x,double y,double z,bool check_autochthonous = false,bool check_softlanding = false, double check_distance = 0.1,int timeout = 3000);
     bool Move_SZ_SX_Y_X_Sync(double x,double y,double y_error,bool check_autochthonous = false,bool check_softlanding = false, double check_distance = 0.1,int timeout = 3000);
     bool Move_SZ_SX_YS_X_Z_Sync(double x,double y,double z,bool check_autochthonous = false,bool check_softlanding = false,double check_distance = 0.1,int timeout = 3000);
     bool Move_SZ_SY_X_Y_Z_Sync(double x,double y,double z,bool check_autochthonous = false,bool check_softlanding = false,double check_distance = 5, int timeout = 3000);
+    XtMotionHandle Move_SZ_SY_X_Y_Z_Async(double x,double y,double z,double check_distance = 5,int timeout = 30000);
     bool Move_SZ_SY_X_YS_Z_Sync(double x,double y,double z,bool check_autochthonous = false,bool check_softlanding = false,double check_distance = 5, int timeout = 3000);
     bool Move_SZ_XY_ToPos(double x,double y,int timeout = 3000);
     bool Wait_XY_ToPos(double x,double y,int timeout = 3000);
@@ -40,6 +44,12 @@ public:
     bool ZSerchByForce(const double speed,const double force,const double search_limit = -1,const int vacuum_state = -1,XtVacuum* excute_vacuum = nullptr);
     bool ZSerchReturn();
     mPoint3D GetFeedBackPos();
+private:
+    const int Z_MOVE_TIMEOUT = 30000;
+    bool MoveZToSafety();
+    bool MoveZToClearance(double x,double y);
+    bool GetXYClearanceZ(double x,double y,double &clearance_z);
+    static double EstimateMoveTime(const XtMotor *motor, double distance);
 };
 
 #endif // MATERIAL_CARRIER_H
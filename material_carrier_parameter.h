@@ -14,12 +14,19 @@ class MaterialCarrierParameter:public PropertyBase
 
     double m_StopTime = 0;
 
+    bool m_BlendMove = false;
+
+    double m_BlendXYDistance = 0;
+
 public:
     MaterialCarrierParameter():PropertyBase (){}
     Q_PROPERTY(double SafetyZ READ SafetyZ WRITE setSafetyZ NOTIFY paramsChanged)
     Q_PROPERTY(double SafetyY READ SafetyY WRITE setSafetyY NOTIFY paramsChanged)
     Q_PROPERTY(double SafetyX READ SafetyX WRITE setSafetyX NOTIFY paramsChanged)
     Q_PROPERTY(double StopTime READ StopTime WRITE setStopTime NOTIFY StopTimeChanged)
+    //XY在Z进入XY轴垂直限位允许的Z区间后开始运动, Z在XY离目标小于BlendXYDistance时开始下降
+    Q_PROPERTY(bool BlendMove READ BlendMove WRITE setBlendMove NOTIFY BlendMoveChanged)
+    Q_PROPERTY(double BlendXYDistance READ BlendXYDistance WRITE setBlendXYDistance NOTIFY BlendXYDistanceChanged)
     double SafetyZ() const
     {
         return m_SafetyZ;
@@ -39,6 +46,16 @@ public:
         return m_StopTime;
     }
 
+    bool BlendMove() const
+    {
+        return m_BlendMove;
+    }
+
+    double BlendXYDistance() const
+    {
+        return m_BlendXYDistance;
+    }
+
 public slots:
     void setSafetyZ(double SafetyZ)
     {
@@ -75,9 +92,29 @@ public slots:
         emit StopTimeChanged(m_StopTime);
     }
 
+    void setBlendMove(bool BlendMove)
+    {
+        if (m_BlendMove == BlendMove)
+            return;
+
+        m_BlendMove = BlendMove;
+        emit BlendMoveChanged(m_BlendMove);
+    }
+
+    void setBlendXYDistance(double BlendXYDistance)
+    {
+        if (qFuzzyCompare(m_BlendXYDistance, BlendXYDistance))
+            return;
+
+        m_BlendXYDistance = BlendXYDistance;
+        emit BlendXYDistanceChanged(m_BlendXYDistance);
+    }
+
 signals:
     void paramsChanged(double SafetyZ);
     void StopTimeChanged(double StopTime);
+    void BlendMoveChanged(bool BlendMove);
+    void BlendXYDistanceChanged(double BlendXYDistance);
 };
 
 #endif // MATERIAL_CARRIER_PARAMETER_H
@@ -289,8 +289,7 @@ void MaterialTray::setTrayPrOffset(PrOffset pr_offset, int index, int tray_index
     temp_data["pr_offset_x"] = pr_offset.X;
     temp_data["pr_offset_y"] = pr_offset.Y;
     temp_data["pr_offset_t"] = pr_offset.Theta;
-    setCurrentMaterialData(tray_index,temp_data);
-    setCurrentMaterialData(tray_index,temp_data);
+    setMaterialData(index,tray_index,temp_data);
     qInfo("setTrayPrOffset tray_index:%d,index:%d,current_index %d,pr_offset_x:%f,pr_offset_y%f",tray_index,index,getCurrentIndex(tray_index),pr_offset.X,pr_offset.Y);
 }
 
@@ -0,0 +1,171 @@
+#include "motiontimingrecorder.h"
+#include "utils/commonutils.h"
+#include <QDataStream>
+#include <QFile>
+#include <QThread>
+#include <QTextStream>
+#include <qmath.h>
+
+MotionTimingRecorder::MotionTimingRecorder()
+{
+    records.resize(RING_SIZE);
+    clock.start();
+}
+
+MotionTimingRecorder *MotionTimingRecorder::instance()
+{
+    static MotionTimingRecorder recorder;
+    return &recorder;
+}
+
+double MotionTimingRecorder::plannedTime(double distance, double vel, double acc, double jerk)
+{
+    distance = fabs(distance);
+    if(distance <= 0||vel <= 0||acc <= 0)
+        return 0;
+    double time;
+    if(distance < vel*vel/acc)
+        time = 2*sqrt(distance/acc);
+    else
+        time = distance/vel + vel/acc;
+    //加加速度限制使每段加速多出acc/jerk
+    if(jerk > 0)
+        time += acc/jerk;
+    return time*1000;
+}
+
+int MotionTimingRecorder::nameIndex(QStringList &names, const QString &name)
+{
+    int index = names.indexOf(name);
+    if(index < 0)
+    {
+        names.append(name);
+        index = names.size() - 1;
+    }
+    return index;
+}
+
+void MotionTimingRecorder::beginMove(Record &record, const QString &axis_name, MoveType type, double start_pos, double target_pos,
+                                     double vel, double acc, double jerk)
+{
+    QString module_name = QThread::currentThread()->objectName();
+    if(module_name.isEmpty())
+        module_name = "unknown";
+    {
+        QMutexLocker tmpLocker(&locker);
+        record.axis = nameIndex(axisNames,axis_name);
+        record.module = nameIndex(moduleNames,module_name);
+    }
+    record.moveType = type;
+    record.arrived = -1;
+    record.startPos = start_pos;
+    record.targetPos = target_pos;
+    record.distance = fabs(target_pos - start_pos);
+    record.vel = vel;
+    record.acc = acc;
+    record.jerk = jerk;
+    record.plannedTime = plannedTime(record.distance,vel,acc,jerk);
+    record.arrivedTime = 0;
+    record.settleTime = 0;
+    record.commandTime = clock.nsecsElapsed()/1000;
+}
+
+void MotionTimingRecorder::endMove(Record &record, bool arrived, double settle_time)
+{
+    if(!isOpen(record))
+        return;
+    record.arrived = arrived?1:0;
+    record.settleTime = settle_time;
+    record.arrivedTime = (clock.nsecsElapsed()/1000 - record.commandTime)/1000.0 - settle_time;
+
+    QMutexLocker tmpLocker(&locker);
+    records[nextRecord] = record;
+    nextRecord = (nextRecord + 1)%RING_SIZE;
+    recordCount++;
+
+    Statistic &statistic = statistics[(qint64(record.axis)<<8)|record.moveType];
+    statistic.count++;
+    if(!arrived)
+    {
+        statistic.timeoutCount++;
+        return;
+    }
+    int arrived_count = statistic.count - statistic.timeoutCount;
+    if(arrived_count == 1||record.arrivedTime < statistic.minArrivedTime)
+        statistic.minArrivedTime = record.arrivedTime;
+    if(arrived_count == 1||record.arrivedTime > statistic.maxArrivedTime)
+        statistic.maxArrivedTime = record.arrivedTime;
+    statistic.distance += record.distance;
+    statistic.plannedTime += record.plannedTime;
+    statistic.arrivedTime += record.arrivedTime;
+    statistic.settleTime += record.settleTime;
+    if(record.plannedTime > 0)
+    {
+        double ratio = record.arrivedTime/record.plannedTime;
+        statistic.ratio += ratio;
+        statistic.maxRatio = qMax(statistic.maxRatio,ratio);
+    }
+}
+
+bool MotionTimingRecorder::exportReport(QString dir)
+{
+    if(dir.isEmpty())
+        dir = getPerformanceLogDir();
+    QString file_name = QString(dir).append(getCurrentTimeString()).append("_motion_timing");
+
+    QMutexLocker tmpLocker(&locker);
+    QFile trace_file(QString(file_name).append(".bin"));
+    if(!trace_file.open(QIODevice::WriteOnly))
+    {
+        qWarning("open %s fail",trace_file.fileName().toStdString().c_str());
+        return false;
+    }
+    //文件头: 标识 版本 轴名表 模块名表 记录数, 之后按时间顺序写记录
+    QDataStream trace(&trace_file);
+    int count = int(qMin(recordCount,qint64(RING_SIZE)));
+    trace << quint32(0x4d545231) << qint32(1) << axisNames << moduleNames << qint32(count);
+    for (int i = 0; i < count; ++i)
+    {
+        const Record &record = records[(nextRecord - count + i + RING_SIZE)%RING_SIZE];
+        trace << record.commandTime << record.axis << record.module << record.moveType << record.arrived
+              << record.startPos << record.targetPos << record.distance << record.vel << record.acc << record.jerk
+              << record.plannedTime << record.arrivedTime << record.settleTime;
+    }
+    trace_file.close();
+
+    QFile summary_file(QString(file_name).append(".csv"));
+    if(!summary_file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        qWarning("open %s fail",summary_file.fileName().toStdString().c_str());
+        return false;
+    }
+    const char *type_names[MoveTypeCount] = {"move","slow_move","safty_move","step_move"};
+    QTextStream summary(&summary_file);
+    summary << "axis,move_type,count,timeout,avg_distance,avg_planned_ms,avg_arrived_ms,min_arrived_ms,max_arrived_ms,avg_settle_ms,avg_ratio,max_ratio\n";
+    for (int axis = 0; axis < axisNames.size(); ++axis)
+    {
+        for (int type = 0; type < MoveTypeCount; ++type)
+        {
+            qint64 key = (qint64(axis)<<8)|type;
+            if(!statistics.contains(key))
+                continue;
+            const Statistic &statistic = statistics[key];
+            int arrived_count = qMax(1,statistic.count - statistic.timeoutCount);
+            summary << axisNames[axis] << "," << type_names[type] << "," << statistic.count << "," << statistic.timeoutCount << ","
+                    << statistic.distance/arrived_count << "," << statistic.plannedTime/arrived_count << ","
+                    << statistic.arrivedTime/arrived_count << "," << statistic.minArrivedTime << "," << statistic.maxArrivedTime << ","
+                    << statistic.settleTime/arrived_count << "," << statistic.ratio/arrived_count << "," << statistic.maxRatio << "\n";
+        }
+    }
+    summary_file.close();
+    qInfo("export motion timing %lld records to %s",recordCount,file_name.toStdString().c_str());
+    return true;
+}
+
+void MotionTimingRecorder::clear()
+{
+    QMutexLocker tmpLocker(&locker);
+    nextRecord = 0;
+    recordCount = 0;
+    statistics.clear();
+}
@@ -0,0 +1,93 @@
+#ifndef MOTIONTIMINGRECORDER_H
+#define MOTIONTIMINGRECORDER_H
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/*
+ * Always-on timing record of the XtMotor moves.
+ * A move is opened when the motor issues it and closed by the wait on its
+ * target; the record keeps the profile estimate next to the measured
+ * arrival and settle time, so a slow axis or a mistuned profile shows up as
+ * a high actual/planned ratio in the summary.
+ * Records go to a fixed ring buffer, the per axis/move type statistics are
+ * kept since start; exportReport writes the ring as a binary trace and the
+ * statistics as csv into the performance log folder.
+ */
+class MotionTimingRecorder
+{
+public:
+    enum MoveType
+    {
+        NormalMove = 0,
+        SlowMove = 1,
+        SaftyMove = 2,
+        StepMove = 3,
+        MoveTypeCount
+    };
+
+    struct Record
+    {
+        qint64 commandTime;     //下发时间, 记录器启动后的us
+        qint32 axis;            //轴名表的索引
+        qint32 module;          //调用模块名表的索引
+        qint32 moveType;
+        qint32 arrived;         //-1未结束 1到位 0超时
+        double startPos;
+        double targetPos;
+        double distance;
+        double vel;
+        double acc;
+        double jerk;
+        double plannedTime;     //按速度加速度加加速度估算的运动时间ms
+        double arrivedTime;     //下发到进入到位误差的时间ms
+        double settleTime;      //到位后的延时ms
+    };
+
+    static MotionTimingRecorder *instance();
+    static double plannedTime(double distance, double vel, double acc, double jerk);
+
+    void beginMove(Record &record, const QString &axis_name, MoveType type, double start_pos, double target_pos,
+                   double vel, double acc, double jerk);
+    void endMove(Record &record, bool arrived, double settle_time);
+    static bool isOpen(const Record &record)
+    {
+        return record.arrived < 0;
+    }
+    bool exportReport(QString dir = "");
+    void clear();
+
+private:
+    MotionTimingRecorder();
+    int nameIndex(QStringList &names, const QString &name);
+
+    struct Statistic
+    {
+        int count = 0;
+        int timeoutCount = 0;
+        double distance = 0;
+        double plannedTime = 0;
+        double arrivedTime = 0;
+        double minArrivedTime = 0;
+        double maxArrivedTime = 0;
+        double settleTime = 0;
+        double ratio = 0;
+        double maxRatio = 0;
+    };
+
+    const int RING_SIZE = 65536;
+    QElapsedTimer clock;
+    QMutex locker;
+    QStringList axisNames;
+    QStringList moduleNames;
+    QVector<Record> records;
+    int nextRecord = 0;
+    qint64 recordCount = 0;
+    QHash<qint64,Statistic> statistics;
+};
+
+#endif // MOTIONTIMINGRECORDER_H
@@ -0,0 +1,187 @@
+#include "motorlimitindex.h"
+#include "iolimitparameter.h"
+#include "parallellimitparameter.h"
+#include "verticallimitparameter.h"
+#include <algorithm>
+
+void LimitIntervalSet::append(const QVariantList &spance, int id)
+{
+    for (int i = 0; i < spance.size()/2; ++i)
+    {
+        Interval interval;
+        interval.start = spance[2*i].toDouble();
+        interval.end = spance[2*i+1].toDouble();
+        interval.id = id;
+        intervals.append(interval);
+    }
+}
+
+void LimitIntervalSet::build()
+{
+    std::stable_sort(intervals.begin(), intervals.end(), [](const Interval &a, const Interval &b){ return a.start < b.start; });
+    starts.clear();
+    maxEnds.clear();
+    for (int i = 0; i < intervals.size(); ++i)
+    {
+        starts.append(intervals[i].start);
+        maxEnds.append(i == 0 ? intervals[i].end : qMax(maxEnds[i-1], intervals[i].end));
+    }
+}
+
+int LimitIntervalSet::countStartNotAfter(double value) const
+{
+    return int(std::upper_bound(starts.begin(), starts.end(), value) - starts.begin());
+}
+
+bool LimitIntervalSet::overlaps(double start, double end) const
+{
+    //存在 起点<=end 且 终点>=start 的区间
+    int count = countStartNotAfter(end);
+    return count > 0 && maxEnds[count-1] >= start;
+}
+
+bool LimitIntervalSet::contains(double start, double end) const
+{
+    //存在 起点<=start 且 终点>=end 的区间
+    int count = countStartNotAfter(start);
+    return count > 0 && maxEnds[count-1] >= end;
+}
+
+QVector<int> LimitIntervalSet::overlapping(double start, double end) const
+{
+    QVector<int> result;
+    int count = countStartNotAfter(end);
+    if(count == 0 || maxEnds[count-1] < start)
+        return result;
+    for (int i = 0; i < count; ++i)
+        if(intervals[i].end >= start)
+            result.append(intervals[i].id);
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+void MotorLimitIndex::compile(const QList<VerticalLimitParameter *> &vertical, const QList<ParallelLimitParameter *> &parallel,
+                              const QList<IOLimitParameter *> &io)
+{
+    verticalMove = LimitIntervalSet();
+    verticalLimit.clear();
+    for (int i = 0; i < vertical.size(); ++i)
+    {
+        verticalMove.append(vertical[i]->moveSpance(), i);
+        LimitIntervalSet limit;
+        limit.append(vertical[i]->limitSpance());
+        limit.build();
+        verticalLimit.append(limit);
+    }
+    verticalMove.build();
+
+    parallelEffect.clear();
+    foreach (ParallelLimitParameter *parameter, parallel)
+    {
+        ParallelEntry entry;
+        entry.anyX = parameter->effectXSpance().size() < 2;
+        entry.anyY = parameter->effectYSpance().size() < 2;
+        entry.effectX.append(parameter->effectXSpance());
+        entry.effectX.build();
+        entry.effectY.append(parameter->effectYSpance());
+        entry.effectY.build();
+        parallelEffect.append(entry);
+    }
+
+    ioMove = LimitIntervalSet();
+    for (int i = 0; i < io.size(); ++i)
+        ioMove.append(io[i]->moveSpance(), i);
+    ioMove.build();
+
+    verticalCount = vertical.size();
+    parallelCount = parallel.size();
+    ioCount = io.size();
+}
+
+int MotorLimitIndex::verify(const QList<VerticalLimitParameter *> &vertical, const QList<ParallelLimitParameter *> &parallel,
+                            const QList<IOLimitParameter *> &io)
+{
+    //在所有区间端点及其两侧取样, 逐对与参数的原始判断比较
+    QVector<double> samples;
+    auto addSamples = [&samples](const QVariantList &spance)
+    {
+        foreach (QVariant value, spance)
+        {
+            double position = value.toDouble();
+            samples << position - 0.001 << position << position + 0.001;
+        }
+    };
+    foreach (VerticalLimitParameter *parameter, vertical)
+    {
+        addSamples(parameter->moveSpance());
+        addSamples(parameter->limitSpance());
+    }
+    foreach (ParallelLimitParameter *parameter, parallel)
+    {
+        addSamples(parameter->effectXSpance());
+        addSamples(parameter->effectYSpance());
+    }
+    foreach (IOLimitParameter *parameter, io)
+        addSamples(parameter->moveSpance());
+    samples.append(0);
+    std::sort(samples.begin(), samples.end());
+    samples.erase(std::unique(samples.begin(), samples.end()), samples.end());
+
+    const double far = 1e12;
+    int mismatch = 0;
+    foreach (double start, samples)
+    {
+        foreach (double end, samples)
+        {
+            QVector<int> candidates = verticalCandidates(start, end);
+            for (int i = 0; i < vertical.size(); ++i)
+            {
+                if(vertical[i]->hasInterferenceWithMoveSpance(start, end) != candidates.contains(i))
+                    mismatch++;
+                if(vertical[i]->checkInLimitSpance(start, end) != verticalInLimit(i, start, end))
+                    mismatch++;
+            }
+            for (int i = 0; i < parallel.size(); ++i)
+            {
+                if(parallel[i]->hasInInterferenceSpance(start, end, -far, far) != parallelInInterference(i, start, end, -far, far))
+                    mismatch++;
+                if(parallel[i]->hasInInterferenceSpance(-far, far, start, end) != parallelInInterference(i, -far, far, start, end))
+                    mismatch++;
+            }
+            candidates = ioCandidates(start, end);
+            for (int i = 0; i < io.size(); ++i)
+                if(io[i]->hasInterferenceWithMoveSpance(start, end) != candidates.contains(i))
+                    mismatch++;
+        }
+    }
+    return mismatch;
+}
+
+bool MotorLimitIndex::isCompiled(int vertical_count, int parallel_count, int io_count) const
+{
+    return verticalCount == vertical_count && parallelCount == parallel_count && ioCount == io_count;
+}
+
+QVector<int> MotorLimitIndex::verticalCandidates(double start, double end) const
+{
+    return verticalMove.overlapping(qMin(start, end), qMax(start, end));
+}
+
+bool MotorLimitIndex::verticalInLimit(int index, double start, double end) const
+{
+    return verticalLimit[index].contains(qMin(start, end), qMax(start, end));
+}
+
+bool MotorLimitIndex::parallelInInterference(int index, double start_x, double end_x, double start_y, double end_y) const
+{
+    const ParallelEntry &entry = parallelEffect[index];
+    if(!entry.anyX && !entry.effectX.overlaps(qMin(start_x, end_x), qMax(start_x, end_x)))
+        return false;
+    return entry.anyY || entry.effectY.overlaps(qMin(start_y, end_y), qMax(start_y, end_y));
+}
+
+QVector<int> MotorLimitIndex::ioCandidates(double start, double end) const
+{
+    return ioMove.overlapping(qMin(start, end), qMax(start, end));
+}
@@ -0,0 +1,78 @@
+#ifndef MOTORLIMITINDEX_H
+#define MOTORLIMITINDEX_H
+
+#include <QList>
+#include <QVector>
+#include <QVariantList>
+
+class VerticalLimitParameter;
+class ParallelLimitParameter;
+class IOLimitParameter;
+
+//按起点排序的区间表, 记录前缀最大终点, 相交和包含查询各一次二分查找
+class LimitIntervalSet
+{
+public:
+    void append(const QVariantList &spance, int id = 0);
+    void build();
+    bool isEmpty() const
+    {
+        return intervals.isEmpty();
+    }
+    bool overlaps(double start, double end) const;
+    bool contains(double start, double end) const;
+    QVector<int> overlapping(double start, double end) const;
+
+private:
+    struct Interval
+    {
+        double start;
+        double end;
+        int id;
+    };
+    int countStartNotAfter(double value) const;
+
+    QVector<Interval> intervals;
+    QVector<double> starts;
+    QVector<double> maxEnds;
+};
+
+/*
+ * Limit definitions of one motor compiled when the limit file is loaded.
+ * Indexes refer to the motor's vertical, parallel and io limit lists, and
+ * the candidate lists keep list order so a failing check reports the same
+ * limit as the scan over the parameters did.
+ */
+class MotorLimitIndex
+{
+public:
+    void compile(const QList<VerticalLimitParameter*> &vertical, const QList<ParallelLimitParameter*> &parallel,
+                 const QList<IOLimitParameter*> &io);
+    int verify(const QList<VerticalLimitParameter*> &vertical, const QList<ParallelLimitParameter*> &parallel,
+               const QList<IOLimitParameter*> &io);
+    bool isCompiled(int vertical_count, int parallel_count, int io_count) const;
+
+    QVector<int> verticalCandidates(double start, double end) const;
+    bool verticalInLimit(int index, double start, double end) const;
+    bool parallelInInterference(int index, double start_x, double end_x, double start_y, double end_y) const;
+    QVector<int> ioCandidates(double start, double end) const;
+
+private:
+    struct ParallelEntry
+    {
+        bool anyX;
+        bool anyY;
+        LimitIntervalSet effectX;
+        LimitIntervalSet effectY;
+    };
+
+    LimitIntervalSet verticalMove;
+    QVector<LimitIntervalSet> verticalLimit;
+    QVector<ParallelEntry> parallelEffect;
+    LimitIntervalSet ioMove;
+    int verticalCount = -1;
+    int parallelCount = -1;
+    int ioCount = -1;
+};
+
+#endif // MOTORLIMITINDEX_H
@@ -5,6 +5,7 @@
 #include "sensorloaderparameter.h"
 #include "sensorpickarm.h"
 #include "network/sparrowqserver.h"
+#include "XtGeneralOutput.h"
 #include "thread_worker_base.h"
 #include "uphhelper.h"
 #include "vision/vision_location.h"
@@ -127,6 +128,7 @@ public:
               VisionLocation *sut_sensor_location,
               VisionLocation *sut_product_location,
               VisionLocation *sensor_pickarm_calibration_glass_location,
+              XtGeneralOutput *camera_trig,
               int thread_id);
 //    void openServer(int port);
     Q_INVOKABLE void cameraTipOffsetCalibration(int pickhead);
@@ -171,7 +173,11 @@ private:
     bool moveCameraToSUTPRPos(bool is_local = true,bool check_softlanding = false);
     bool moveCameraToStandbyPos(bool check_arrived = false,bool check_softlanding = false);
     //执行视觉
-    bool performTraySensorPR();
+    bool performTraySensorPR(bool use_pre_result = false);
+    bool prepareTrayPrePR(int tray_index);
+    bool performTrayLookaheadPR();
+    bool performTrayFlyPR(int tray_index);
+    bool performTrayBatchPR(int tray_index);
     bool performTrayEmptyPR();
     bool performSUTEmptyPR();
     bool performSUTSensorPR();
@@ -198,11 +204,11 @@ private:
     bool placeProductToTray(int tray_id,int time_out = 10000);
     bool placeProductToBuferr(int time_out = 10000);
 
-    bool picker1PickFromTray(double z,int time_out = 10000);
+    bool picker1PickFromTray(double z,int time_out = 10000,int tray_id = -1);
     bool picker1BackToTray(double z,int time_out = 10000);
     bool picker1PlaceToSut(double z,bool is_local,int time_out = 10000);
     bool picker2PickFromSut(double z,double force,bool is_local,int time_out = 10000);
-    bool picker2PlaceToTray(double z,double force,bool is_product,int time_out = 10000);
+    bool picker2PlaceToTray(double z,double force,bool is_product,int time_out = 10000,int tray_id = -1);
     //真空动作
     void openSut1Vacuum();
     void closeSut1Vacuum();
@@ -288,6 +294,7 @@ private:
     VisionLocation *sut_sensor_location = Q_NULLPTR;
     VisionLocation *sut_product_location = Q_NULLPTR;
     VisionLocation * sensor_pickarm_calibration_glass_location = Q_NULLPTR;
+    XtGeneralOutput * camera_trig = Q_NULLPTR;
     int thread_id = 0;
     bool is_run = false;
     bool finish_stop = false;
@@ -299,6 +306,12 @@ private:
     QVariantMap sut2_sensor_data;
     QVariantMap picker2_senseor_data;
     PrOffset pr_offset;
+    int last_pr_tray_id = -1;
+    int lookahead_pr_count = 0;
+    int lookahead_pr_used = 0;
+    //各盘各穴位的接触高度
+    ContactHeightModel picker1_contact_model;
+    ContactHeightModel picker2_contact_model;
     int sut_raw_material;
     int sut_used_material;
     int picked_material;
@@ -1,4 +1,5 @@
 #include "sensorpickarm.h"
+#include "cycletracerecorder.h"
 #include <QElapsedTimer>
 
 SensorPickArm::SensorPickArm(QString name):ErrorBase (name)
@@ -34,6 +35,7 @@ bool SensorPickArm::checkXYArrived(const double x, const double y)
 bool SensorPickArm::move_XY_Synic(QPointF position,bool check_arrived, bool check_softlanding, int timeout)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer;
     QString temp;
     if(check_softlanding)
@@ -69,6 +71,7 @@ bool SensorPickArm::checkXYT1Arrived(const double x, const double y, const doubl
 bool SensorPickArm::move_XYT1_Synic(const double x, const double y, const double t,const bool check_arrived, const bool check_softlanding, int timeout)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.restart();
     QString temp;
     if(check_softlanding)
@@ -131,6 +134,7 @@ bool SensorPickArm::checkXYT2Arrived(const double x, const double y, const doubl
 bool SensorPickArm::move_XYT2_Synic(const double x, const double y, const double t,const bool check_arrived, const bool check_softlanding, int timeout)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     if(check_softlanding)
@@ -214,6 +218,7 @@ bool SensorPickArm::move_XeYe_Z1_XY(double z, double escape_x, double escape_y,
 {
     QString temp;
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     if(check_softlanding)
     {
@@ -273,6 +278,7 @@ bool SensorPickArm::move_XeYe_Z1_XY(double z, double escape_x, double escape_y,
 bool SensorPickArm::move_XeYe_Z2(double z, double escape_x, double escape_y, const bool check_softlanding, int timeout)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     if(check_softlanding)
@@ -1,4 +1,5 @@
 ﻿#include "sensortrayloadermodule.h"
+#include "cycletracerecorder.h"
 #include "tcpmessager.h"
 #include <QElapsedTimer>
 SensorTrayLoaderModule::SensorTrayLoaderModule():ThreadWorkerBase ("SensorTrayLoaderModule")
@@ -150,7 +151,7 @@ void SensorTrayLoaderModule::performHandlingOperation(int cmd,QVariant param)
         result &= motor_push->MoveToPosSync(parameters.pushoutPosition());
         result &= motor_push->MoveToPosSync(0);
     }
-    is_handling = false;
+    finishHandling();
     return;
 }
 
@@ -705,6 +706,7 @@ bool SensorTrayLoaderModule::moveToChangeVacancyTrayAndUpReadyTray(bool has_vaca
 bool SensorTrayLoaderModule::moveToUpReadyTray(bool has_tray)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     bool result =checkEntanceTray(false);
     result &= gripper->Set(true);
     if(result)
@@ -736,6 +738,7 @@ bool SensorTrayLoaderModule::moveToWaitHandleTray()
 bool SensorTrayLoaderModule::moveToPullNextTray()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     bool result_push = true;
     bool result_return = true;
     if(!states.isLastTray())
@@ -825,6 +828,7 @@ bool SensorTrayLoaderModule::moveToWorkPos(bool has_tray)
 bool SensorTrayLoaderModule::moveToEntranceClipNextPos()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     qInfo("moveToEntranceClipNextPos");
     if(motor_push->GetFeedbackPos() > parameters.pushMotorSafePosition())
     {
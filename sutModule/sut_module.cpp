@@ -1,4 +1,5 @@
 ﻿#include "sutModule/sut_module.h"
+#include "cycletracerecorder.h"
 
 #include <QMessageBox>
 #include <tcpmessager.h>
@@ -53,6 +54,7 @@ void SutModule::saveJsonConfig(QString file_name)
 bool SutModule::checkSutHasMaterialSynic()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     bool result;
     result = vacuum->checkHasMaterielSync();
     if(result||RunMode::NoMaterial == states.runMode())
@@ -70,6 +72,7 @@ bool SutModule::checkSutHasMaterialSynic()
 bool SutModule::checkSutHasMaterial()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     bool result;
     result = vacuum->checkHasMateriel(thread_id);
     qWarning("[Timelog] %s %d", __FUNCTION__, timer.elapsed());
@@ -79,6 +82,7 @@ bool SutModule::checkSutHasMaterial()
 bool SutModule::waitSutCheckResult(bool check_state)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     bool result;
     result = vacuum->getHasMateriel(thread_id);
     if(result == check_state||RunMode::NoMaterial == states.runMode())
@@ -113,6 +117,7 @@ void SutModule::loadParams(QString file_name)
 bool SutModule::moveToDownlookPR(PrOffset &offset,bool close_lighting,bool check_autochthonous)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer; smallTimer.start();
     QString temp;
     vision_downlook_location->OpenLight();
@@ -166,6 +171,7 @@ bool SutModule::moveToDownlookSaveImage(QString imageName,bool close_lighting,bo
 bool SutModule::moveToLoadPos(bool check_autochthonous)
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     QElapsedTimer smallTimer;
 
     double dist_x = fabs(carrier->motor_x->GetFeedbackPos() - load_position.X());
@@ -696,7 +702,7 @@ void SutModule::performHandlingOperation(int cmd,QVariant param)
     }
     if(!result)
         sendAlarmMessage(OK_OPERATION,GetCurrentError(),ErrorLevel::TipNonblock);
-    is_handling = false;
+    finishHandling();
 }
 
 void SutModule::receivceModuleMessage(QVariantMap message)
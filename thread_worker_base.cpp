@@ -1,6 +1,8 @@
 #include "thread_worker_base.h"
 #include <utils/commonutils.h>
 #include "config.h"
+#include "cycletracerecorder.h"
+#include <QElapsedTimer>
 #include <QFile>
 ThreadWorkerBase::ThreadWorkerBase(QString name,QObject *parent) : QObject(parent),ErrorBase (name)
 {
@@ -12,6 +14,7 @@ ThreadWorkerBase::ThreadWorkerBase(QString name,QObject *parent) : QObject(paren
     }
     setName(name);
     this->setObjectName(name);
+    work_thread.setObjectName(name);
     this->moveToThread(&work_thread);
 //    connect(&work_thread, SIGNAL(finished()), this, SLOT(deleteLater()));
     work_thread.start();
@@ -22,6 +25,7 @@ ThreadWorkerBase::~ThreadWorkerBase()
 {
     work_thread.quit();
     work_thread.wait();
+    qDeleteAll(event_conditions);
 }
 
 QString ThreadWorkerBase::Name() const
@@ -61,65 +65,93 @@ int ThreadWorkerBase::sendAlarmMessage(QString error_tips, QString error_message
 
 QString ThreadWorkerBase::waitMessageReturn(bool &interruput,int alarm_id)
 {
-    while (interruput)
-    {
-        QThread::msleep(1000);
-        {
-            QMutexLocker temp_locker(&message_mutex);
-            if(choosed_operations.contains(alarm_id))
-            {
-                QString operation = choosed_operations[alarm_id];
-                qInfo("%s waitMessageReturn %s",Name().toStdString().c_str(),operation.toStdString().c_str());
-                choosed_operations.remove(alarm_id);
-                sendMessageToModule("LogicManager2", "CloseAlarmLight");
-                return operation;
-            }
-        }
-    }
-    return "";
+    QMutexLocker temp_locker(&message_mutex);
+    if(!waitEvent(ALARM_EVENT,[this,alarm_id](){return choosed_operations.contains(alarm_id);},interruput))
+        return "";
+    QString operation = choosed_operations.take(alarm_id);
+    temp_locker.unlock();
+    qInfo("%s waitMessageReturn %s",Name().toStdString().c_str(),operation.toStdString().c_str());
+    sendMessageToModule("LogicManager2", "CloseAlarmLight");
+    return operation;
 }
 
 void ThreadWorkerBase::performHandling(int cmd,QVariant param)
 {
-    if(is_handling)
     {
-        qInfo("is_handling");
-        return;
+        QMutexLocker temp_locker(&message_mutex);
+        if(is_handling)
+        {
+            qInfo("is_handling");
+            return;
+        }
+        is_handling = true;
     }
-    is_handling = true;
     is_error = false;
     emit sendHandlingOperation(cmd,param);
 }
 
 bool ThreadWorkerBase::waitPerformHandling()
 {
-    while (is_handling)
-    {
-        QThread::msleep(10);
-    }
+    QMutexLocker temp_locker(&message_mutex);
+    waitEvent(HANDLING_EVENT,[this](){return !is_handling;},true);
     return is_error;
 }
 
+void ThreadWorkerBase::finishHandling()
+{
+    QMutexLocker temp_locker(&message_mutex);
+    is_handling = false;
+    notifyEvent(HANDLING_EVENT);
+}
+
 bool ThreadWorkerBase::waitResponseMessage(bool &is_run, QString target_message)
 {
-    int current_time = 0;
-    while (is_run)
+    QElapsedTimer timer; timer.start();
+    QMutexLocker temp_locker(&message_mutex);
+    if(!waitEvent(RESPONSE_EVENT,[this,target_message](){
+                  return choosed_operations.contains(1)&&module_message.contains("Response")&&module_message["Response"] == target_message;},is_run))
+        return false;
+    qInfo("wait repnonse time : %lld",timer.elapsed());
+    return true;
+}
+
+bool ThreadWorkerBase::waitEvent(const QString &key, std::function<bool()> condition, const bool &is_run, int timeout)
+{
+    QWaitCondition *event = event_conditions.value(key,nullptr);
+    if(event == nullptr)
     {
-        current_time++;
-        QThread::msleep(10);
+        event = new QWaitCondition();
+        event_conditions.insert(key,event);
+    }
+    QElapsedTimer timer; timer.start();
+    while (!condition())
+    {
+        if(!is_run)
+            return false;
+        qint64 left = EVENT_RECHECK_INTERVAL;
+        if(timeout >= 0)
         {
-            QMutexLocker temp_locker(&message_mutex);
-            if(choosed_operations.contains(1))
-            {
-                if(module_message.contains("Response")&&module_message["Response"] == target_message)
-                {
-                    qInfo("wait repnonse time : %d",current_time*10);
-                    return true;
-                }
-            }
+            left = qMin(left,timeout - timer.elapsed());
+            if(left <= 0)
+                return false;
         }
+        event->wait(&message_mutex,ulong(left));
     }
-    return false;
+    return true;
+}
+
+void ThreadWorkerBase::notifyEvent(const QString &key)
+{
+    QWaitCondition *event = event_conditions.value(key,nullptr);
+    if(event != nullptr)
+        event->wakeAll();
+}
+
+void ThreadWorkerBase::interruptWaits()
+{
+    QMutexLocker temp_locker(&message_mutex);
+    foreach (QWaitCondition *event, event_conditions)
+        event->wakeAll();
 }
 
 //ToDo: check the thread tcp response instead of checking file existence
@@ -151,11 +183,14 @@ void ThreadWorkerBase::receivceModuleMessageBase(QVariantMap message)
     {
         qInfo("receive WorksManager message");
         this->module_message = message;
+        notifyEvent(RESPONSE_EVENT);
     }
     else if(message.contains("OriginModule")&&message["OriginModule"].toString() == "AlarmModule"&&(!choosed_operations.contains(message["AlarmId"].toInt())))
     {
         qInfo("receive AlarmModule message");
         choosed_operations.insert(message["AlarmId"].toInt(),message["Operation"].toString());
+        notifyEvent(ALARM_EVENT);
+        notifyEvent(RESPONSE_EVENT);
     } else if (message["TargetModule"].toString() == VISION_MODULE_2) {
         QString cameraName = message["cameraName"].toString();
         QString filename = message["filename"].toString();
@@ -173,6 +208,9 @@ void ThreadWorkerBase::sendMessageToModule(QString module_name, QString message,
     foreach (QString param_name, param.toObject().keys())
         message_map.insert(param_name,param[param_name].toVariant());
     message_map.insert("OriginModule",Name());
+    //模块间消息只记瞬时事件, 关闭时不做字符串处理
+    if(CycleTraceRecorder::instance()->isEnabled())
+        CycleTraceRecorder::instance()->instant("message",__FUNCTION__,CycleTraceRecorder::instance()->intern(QString("%1:%2").arg(module_name).arg(message)));
     emit sendModuleMessage(message_map);
 }
 
@@ -196,17 +234,14 @@ void ThreadWorkerBase::saveJsonConfig(QString file_name)
 
 QVariantMap ThreadWorkerBase::inquirRunParameters(int out_time)
 {
-    module_message.clear();
-    sendMessageToModule("WorksManager","inquirRunParameters");
-    int current_time = 0;
-    while (current_time < out_time)
     {
-        if(!module_message.isEmpty())
-            return module_message;
-        QThread::msleep(10);
-        current_time += 10;
+        QMutexLocker temp_locker(&message_mutex);
+        module_message.clear();
     }
-    qInfo("inquirRunParameters timeout");
+    sendMessageToModule("WorksManager","inquirRunParameters");
+    QMutexLocker temp_locker(&message_mutex);
+    if(!waitEvent(RESPONSE_EVENT,[this](){return !module_message.isEmpty();},true,out_time))
+        qInfo("inquirRunParameters timeout");
     return module_message;
 }
 void ThreadWorkerBase::setName(QString Name)
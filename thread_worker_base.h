@@ -5,10 +5,13 @@
 
 #include "propertybase.h"
 
+#include <QHash>
 #include <QObject>
 #include <QVariantMap>
+#include <QWaitCondition>
 #include <qmutex.h>
 #include <qthread.h>
+#include <functional>
 
 #define OK_OPERATION u8"确定"
 #define CONTINUE_OPERATION u8"继续"
@@ -89,6 +92,8 @@ public:
     Q_INVOKABLE bool loadJsonConfig(QString file_name);
     Q_INVOKABLE void saveJsonConfig(QString file_name);
     QVariantMap inquirRunParameters(int out_time = 1000);
+    //唤醒所有等待, 让等待者重新检查运行标志
+    void interruptWaits();
 private:
     int getAlarmId();
 
@@ -110,7 +115,18 @@ private:
     QMap<int,QString> choosed_operations;
     bool message_returned = false;
     int alarm_id = 0;
+    QHash<QString,QWaitCondition*> event_conditions;
 protected:
+    //在message_mutex锁内等待key对应的事件直到condition成立; is_run为false或超时返回false
+    bool waitEvent(const QString &key,std::function<bool()> condition,const bool &is_run,int timeout = -1);
+    void notifyEvent(const QString &key);
+    void finishHandling();
+
+    const QString ALARM_EVENT = "Alarm";
+    const QString RESPONSE_EVENT = "Response";
+    const QString HANDLING_EVENT = "Handling";
+    //外部标志的变化不一定有通知, 最长间隔重新检查一次
+    const int EVENT_RECHECK_INTERVAL = 200;
     bool is_handling = false;
     bool is_error = false;
     bool handling_finish = false;
@@ -1,4 +1,5 @@
 ﻿#include "tcpmessager.h"
+#include "cycletracerecorder.h"
 #include "trayloadermodule.h"
 #include "config.h"
 #include <QDebug>
@@ -108,6 +109,7 @@ void TrayLoaderModule::resetLogic()
 bool TrayLoaderModule::sendoutAndReayPushOutEmptyTray()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     bool result = cylinder_ltk2->Set(false);
     if(!result)return false;
     result &= motor_work->MoveToPos(parameters.ltlReleasePos());
@@ -132,6 +134,7 @@ bool TrayLoaderModule::sendoutAndReayPushOutEmptyTray()
 bool TrayLoaderModule::moveToGetAndPushInNewTrayAndPushOutTray()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     bool result = cylinder_tray->Set(true);
     bool out_result = false;
     if(result)
@@ -164,6 +167,7 @@ bool TrayLoaderModule::moveToGetAndPushInNewTrayAndPushOutTray()
 bool TrayLoaderModule::moveToGetAndPushInNewTray()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     bool result = cylinder_tray->Set(true);
     if(result)
         result &= motor_work->MoveToPos(parameters.ltlPressPos());
@@ -185,6 +189,7 @@ bool TrayLoaderModule::moveToGetAndPushInNewTray()
 bool TrayLoaderModule::moveToPushOutTray()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     bool result = cylinder_ltk2->Set(true);
     if(result)
         result &= motor_out->SlowMoveToPosSync(parameters.ltkx2ReleasePos(),parameters.pushVelocity());
@@ -204,6 +209,7 @@ bool TrayLoaderModule::moveToPushOutTray()
 bool TrayLoaderModule::moveToWorkPosAndReayPullNewTray()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     bool in_result = cylinder_ltk1->Set(false);
     bool result = true;
     if(in_result)
@@ -226,6 +232,7 @@ bool TrayLoaderModule::moveToWorkPosAndReayPullNewTray()
 bool TrayLoaderModule::entranceClipMoveToNextPos()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     bool result = motor_clip_in->MoveToPosSync(tray_clip_in->getCurrentPosition());
     if(!result)
         AppendError(QString(u8"移动进料弹夹失败"));
@@ -238,6 +245,7 @@ bool TrayLoaderModule::entranceClipMoveToNextPos()
 bool TrayLoaderModule::moveToReayPullNewTray()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     bool result = cylinder_ltk1->Set(false);
     if(result)
         result &= motor_in->MoveToPosSync(parameters.ltkx1PressPos());
@@ -266,6 +274,7 @@ bool TrayLoaderModule::moveToPushReadyTray()
 bool TrayLoaderModule::clipPushoutTray()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     bool result = cylinder_ltk1->Set(false);
     if(result)
         result &= cylinder_clip->Set(true);
@@ -292,6 +301,7 @@ bool TrayLoaderModule::clipPushoutTray()
 bool TrayLoaderModule::existClipMoveToNextPos()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     bool result = motor_clip_out->MoveToPosSync(tray_clip_out->getCurrentPosition());
     if(!result)
         AppendError(QString(u8"移动出料弹夹失败"));
@@ -332,6 +342,7 @@ bool TrayLoaderModule::moveToWorkPos()
 bool TrayLoaderModule::moveToChangeClipPos()
 {
     QElapsedTimer timer; timer.start();
+    TraceSpan trace_span("action",__FUNCTION__);
     qInfo("moveToChangeClipPos");
     motor_clip_in->MoveToPos(tray_clip_in->standards_parameters.changeClipPos());
     bool result = motor_clip_in->WaitArrivedTargetPos(tray_clip_in->standards_parameters.changeClipPos());
@@ -449,7 +460,7 @@ void TrayLoaderModule::performHandlingOperation(int cmd,QVariant param)
         result = ejectTray();
     if(!result)
         sendAlarmMessage(OK_OPERATION,GetCurrentError(),ErrorLevel::TipNonblock);
-    is_handling = false;
+    finishHandling();
     qInfo("performHandlingOperation cmd:%d finished", cmd);
     is_error = !result;
 }
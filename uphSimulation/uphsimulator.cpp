@@ -0,0 +1,715 @@
+#include "uphSimulation/uphsimulator.h"
+#include "AACore/flowchartgraph.h"
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+namespace
+{
+struct ActionDefault
+{
+    const char *action;
+    double ms;
+    const char *trace;  //导入cycle trace时相加的span名, 可带"线程名:"前缀
+};
+
+const ActionDefault ACTION_DEFAULTS[] = {
+    {"sensor_pick", 1500, "performTraySensorPR,movePicker1ToTrayCurrentPos,pickSensorFromTray"},
+    {"sensor_place", 1100, "movePicker1ToSUTPos,placeSensorToSUT"},
+    {"product_pick", 1000, "movePicker2ToSUTPos,pickProductFromSut"},
+    {"product_place", 1200, "movePicker2ToTrayCurrentPos,placeProductToTray"},
+    {"sensor_tray_change", 15000, ""},
+    {"sut_to_load", 800, ""},
+    {"sut_to_aa", 800, ""},
+    {"lut_to_load", 700, ""},
+    {"lut_to_aa", 1500, "moveToAA1PickLens"},
+    {"lens_pick", 1500, "pickTrayLens"},
+    {"lens_place", 1200, "placeLensToLUT"},
+    {"lens_tray_change", 15000, ""},
+    {"aa_flowchart", 0, ""}     //0为按流程图各项目估算
+};
+}
+
+class UphSimProcess
+{
+public:
+    UphSimProcess(UphSimulator *simulator, const QString &name)
+        :name(name),simulator(simulator)
+    {
+    }
+    virtual ~UphSimProcess()
+    {
+    }
+    virtual void start()
+    {
+    }
+    virtual void receive(const QVariantMap &message) = 0;
+
+    QString report(double total_time) const
+    {
+        QString result = QString("%1 busy %2%").arg(name).arg(total_time > 0?busy_time*100/total_time:0,0,'f',1);
+        QMap<QString,double> temp_times = blocked_times;
+        if(!blocked_reason.isEmpty())
+            temp_times[blocked_reason] += simulator->now() - blocked_start;
+        foreach (QString reason, temp_times.keys())
+            result.append(QString(", %1 %2%").arg(reason).arg(total_time > 0?temp_times[reason]*100/total_time:0,0,'f',1));
+        return result;
+    }
+    const QString name;
+
+protected:
+    //与ThreadWorkerBase::sendMessageToModule相同的消息格式
+    void send(const QString &target, const QString &message, const QVariantMap &param = QVariantMap())
+    {
+        QVariantMap message_map = param;
+        message_map.insert("TargetModule",target);
+        message_map.insert("Message",message);
+        message_map.insert("OriginModule",name);
+        simulator->post(message_map);
+    }
+    void perform(const QString &action, std::function<void()> done)
+    {
+        unblock();
+        busy = true;
+        double time = simulator->sample(action);
+        busy_time += time;
+        simulator->schedule(time,[this,done](){
+            busy = false;
+            done();
+        });
+    }
+    void block(const QString &reason)
+    {
+        if(blocked_reason == reason)
+            return;
+        unblock();
+        blocked_reason = reason;
+        blocked_start = simulator->now();
+    }
+    void unblock()
+    {
+        if(blocked_reason.isEmpty())
+            return;
+        blocked_times[blocked_reason] += simulator->now() - blocked_start;
+        blocked_reason.clear();
+    }
+
+    UphSimulator *simulator;
+    bool busy = false;
+
+private:
+    double busy_time = 0;
+    QString blocked_reason;
+    double blocked_start = 0;
+    QMap<QString,double> blocked_times;
+};
+
+namespace
+{
+class AAProcess:public UphSimProcess
+{
+public:
+    AAProcess(UphSimulator *simulator, const QString &name, const QString &sut_name)
+        :UphSimProcess(simulator,name),sut_name(sut_name)
+    {
+    }
+    void start() override
+    {
+        requestMaterial();
+    }
+    void receive(const QVariantMap &message) override
+    {
+        QString text = message["Message"].toString();
+        if(text == "FinishLoadSensor")
+            has_sensor = true;
+        else if(text == "FinishLoadLens")
+            has_lens = true;
+        check();
+    }
+
+private:
+    void requestMaterial()
+    {
+        has_sensor = false;
+        has_lens = false;
+        send(sut_name,"LoadSensorRequest");
+        send("LUTModule","LoadLensRequest");
+        check();
+    }
+    void check()
+    {
+        if(busy)
+            return;
+        if(has_sensor&&has_lens)
+        {
+            perform("aa_flowchart",[this](){
+                simulator->finishUnit(simulator->isNgUnit());
+                requestMaterial();
+            });
+        }
+        else if(has_sensor)
+            block("wait lens");
+        else if(has_lens)
+            block("wait sensor");
+        else
+            block("wait sensor and lens");
+    }
+    QString sut_name;
+    bool has_sensor = false;
+    bool has_lens = false;
+};
+
+class SutProcess:public UphSimProcess
+{
+public:
+    SutProcess(UphSimulator *simulator, const QString &name, const QString &aa_name)
+        :UphSimProcess(simulator,name),aa_name(aa_name)
+    {
+    }
+    void receive(const QVariantMap &message) override
+    {
+        QString text = message["Message"].toString();
+        if(text == "LoadSensorRequest")
+        {
+            perform("sut_to_load",[this](){
+                send("SensorLoaderModule","SutReady");
+                block("wait sensor loader");
+            });
+        }
+        else if(text == "FinishLoadSensor")
+        {
+            perform("sut_to_aa",[this](){
+                send(aa_name,"FinishLoadSensor");
+            });
+        }
+    }
+
+private:
+    QString aa_name;
+};
+
+class SensorLoaderProcess:public UphSimProcess
+{
+public:
+    using UphSimProcess::UphSimProcess;
+    void start() override
+    {
+        tray_left = simulator->sensorsPerTray();
+        next();
+    }
+    void receive(const QVariantMap &message) override
+    {
+        QString text = message["Message"].toString();
+        if(text == "SutReady")
+            ready_suts.append(message["OriginModule"].toString());
+        else if(text == "FinishChangeTray")
+        {
+            tray_left = simulator->sensorsPerTray();
+            waiting_tray = false;
+        }
+        next();
+    }
+
+private:
+    void next()
+    {
+        if(busy)
+            return;
+        if(has_sensor&&!ready_suts.isEmpty())
+        {
+            serve(ready_suts.takeFirst());
+            return;
+        }
+        if(!has_sensor)
+        {
+            if(tray_left > 0)
+            {
+                perform("sensor_pick",[this](){
+                    tray_left--;
+                    has_sensor = true;
+                    next();
+                });
+                return;
+            }
+            if(!waiting_tray)
+            {
+                send("SensorTrayLoaderModule","ChangeTrayResquest");
+                waiting_tray = true;
+            }
+            block("wait sensor tray");
+            return;
+        }
+        block("wait sut request");
+    }
+    void serve(const QString &sut)
+    {
+        bool has_product = sut_products.value(sut,false);
+        std::function<void()> place_sensor = [this,sut,has_product](){
+            perform("sensor_place",[this,sut,has_product](){
+                has_sensor = false;
+                sut_products[sut] = true;
+                send(sut,"FinishLoadSensor");
+                if(has_product)
+                    perform("product_place",[this](){next();});
+                else
+                    next();
+            });
+        };
+        if(has_product)
+            perform("product_pick",place_sensor);
+        else
+            place_sensor();
+    }
+    QStringList ready_suts;
+    QHash<QString,bool> sut_products;
+    bool has_sensor = false;
+    bool waiting_tray = false;
+    int tray_left = 0;
+};
+
+class LutProcess:public UphSimProcess
+{
+public:
+    using UphSimProcess::UphSimProcess;
+    void start() override
+    {
+        next();
+    }
+    void receive(const QVariantMap &message) override
+    {
+        QString text = message["Message"].toString();
+        if(text == "LoadLensRequest")
+            requests.append(message["OriginModule"].toString());
+        else if(text == "FinishLoadLens")
+        {
+            has_lens = true;
+            waiting_lens = false;
+        }
+        next();
+    }
+
+private:
+    void next()
+    {
+        if(busy)
+            return;
+        if(!has_lens)
+        {
+            if(!waiting_lens)
+            {
+                perform("lut_to_load",[this](){
+                    send("LensLoaderModule","LoadLensRequest");
+                    waiting_lens = true;
+                    next();
+                });
+                return;
+            }
+            block("wait lens loader");
+            return;
+        }
+        if(requests.isEmpty())
+        {
+            block("wait aa request");
+            return;
+        }
+        QString aa = requests.takeFirst();
+        perform("lut_to_aa",[this,aa](){
+            has_lens = false;
+            send(aa,"FinishLoadLens");
+            next();
+        });
+    }
+    QStringList requests;
+    bool has_lens = false;
+    bool waiting_lens = false;
+};
+
+class LensLoaderProcess:public UphSimProcess
+{
+public:
+    using UphSimProcess::UphSimProcess;
+    void start() override
+    {
+        tray_left = simulator->lensesPerTray();
+        next();
+    }
+    void receive(const QVariantMap &message) override
+    {
+        QString text = message["Message"].toString();
+        if(text == "LoadLensRequest")
+            requests++;
+        else if(text == "FinishChangeTray")
+        {
+            tray_left = simulator->lensesPerTray();
+            waiting_tray = false;
+        }
+        next();
+    }
+
+private:
+    void next()
+    {
+        if(busy)
+            return;
+        if(has_lens&&requests > 0)
+        {
+            perform("lens_place",[this](){
+                requests--;
+                has_lens = false;
+                send("LUTModule","FinishLoadLens");
+                next();
+            });
+            return;
+        }
+        if(!has_lens)
+        {
+            if(tray_left > 0)
+            {
+                perform("lens_pick",[this](){
+                    tray_left--;
+                    has_lens = true;
+                    next();
+                });
+                return;
+            }
+            if(!waiting_tray)
+            {
+                send("LensTrayLoaderModule","ChangeTrayResquest");
+                waiting_tray = true;
+            }
+            block("wait lens tray");
+            return;
+        }
+        block("wait lut request");
+    }
+    int requests = 0;
+    bool has_lens = false;
+    bool waiting_tray = false;
+    int tray_left = 0;
+};
+
+class TrayLoaderProcess:public UphSimProcess
+{
+public:
+    TrayLoaderProcess(UphSimulator *simulator, const QString &name, const QString &action)
+        :UphSimProcess(simulator,name),action(action)
+    {
+    }
+    void receive(const QVariantMap &message) override
+    {
+        if(message["Message"].toString() != "ChangeTrayResquest")
+            return;
+        QString origin = message["OriginModule"].toString();
+        perform(action,[this,origin](){
+            send(origin,"FinishChangeTray");
+        });
+    }
+
+private:
+    QString action;
+};
+}
+
+UphSimulator::UphSimulator()
+{
+    for (const ActionDefault &action_default : ACTION_DEFAULTS) {
+        durations.insert(action_default.action,action_default.ms);
+        QString trace = action_default.trace;
+        if(!trace.isEmpty())
+            trace_names.insert(action_default.action,trace.split(","));
+    }
+}
+
+UphSimulator::~UphSimulator()
+{
+    reset();
+}
+
+bool UphSimulator::loadConfig(const QString &file_name)
+{
+    QFile file(file_name);
+    if(!file.open(QIODevice::ReadOnly))
+    {
+        qWarning("open uph simulation config %s fail",file_name.toStdString().c_str());
+        return false;
+    }
+    QJsonObject config = QJsonDocument::fromJson(file.readAll()).object();
+    file.close();
+    unit_target = config.value("units").toInt(unit_target);
+    sensors_per_tray = config.value("sensorsPerTray").toInt(sensors_per_tray);
+    lenses_per_tray = config.value("lensesPerTray").toInt(lenses_per_tray);
+    jitter = config.value("jitter").toDouble(jitter);
+    ng_rate = config.value("ngRate").toDouble(ng_rate);
+    message_latency = config.value("messageLatency").toDouble(message_latency);
+    seed = uint(config.value("seed").toInt(int(seed)));
+    QJsonObject temp_names = config.value("traceNames").toObject();
+    foreach (QString action, temp_names.keys()) {
+        QStringList names;
+        foreach (QJsonValue name, temp_names.value(action).toArray())
+            names.append(name.toString());
+        trace_names.insert(action,names);
+    }
+    //先导入实测, 再用配置的时间覆盖
+    if(config.contains("trace")&&!loadTrace(config.value("trace").toString()))
+        return false;
+    QJsonObject temp_durations = config.value("durations").toObject();
+    foreach (QString action, temp_durations.keys())
+        setDuration(action,temp_durations.value(action).toDouble());
+    if(config.contains("flowchart"))
+    {
+        QFile flowchart_file(config.value("flowchart").toString());
+        if(!flowchart_file.open(QIODevice::ReadOnly))
+        {
+            qWarning("open flowchart %s fail",config.value("flowchart").toString().toStdString().c_str());
+            return false;
+        }
+        setFlowchart(QJsonDocument::fromJson(flowchart_file.readAll()).object());
+    }
+    return true;
+}
+
+bool UphSimulator::loadTrace(const QString &file_name)
+{
+    QFile file(file_name);
+    if(!file.open(QIODevice::ReadOnly))
+    {
+        qWarning("open cycle trace %s fail",file_name.toStdString().c_str());
+        return false;
+    }
+    QJsonArray trace_events = QJsonDocument::fromJson(file.readAll()).object().value("traceEvents").toArray();
+    file.close();
+    QHash<int,QString> thread_names;
+    foreach (QJsonValue value, trace_events) {
+        QJsonObject event = value.toObject();
+        if(event.value("ph").toString() == "M"&&event.value("name").toString() == "thread_name")
+            thread_names.insert(event.value("tid").toInt(),event.value("args").toObject().value("name").toString());
+    }
+    //span名、"线程名:span名"和测试项目名各自取平均
+    QHash<QString,double> sums;
+    QHash<QString,int> counts;
+    foreach (QJsonValue value, trace_events) {
+        QJsonObject event = value.toObject();
+        if(event.value("ph").toString() != "X")
+            continue;
+        QString name = event.value("name").toString();
+        double time = event.value("dur").toDouble()/1000;
+        QStringList keys;
+        keys << name << QString("%1:%2").arg(thread_names.value(event.value("tid").toInt())).arg(name);
+        if(name == "performTest")
+            keys << QString("item:%1").arg(event.value("args").toObject().value("detail").toString());
+        foreach (QString key, keys) {
+            sums[key] += time;
+            counts[key]++;
+        }
+    }
+    int loaded = 0;
+    foreach (QString action, trace_names.keys()) {
+        double time = 0;
+        bool found = false;
+        foreach (QString name, trace_names[action]) {
+            if(counts.value(name) > 0)
+            {
+                time += sums[name]/counts[name];
+                found = true;
+            }
+        }
+        if(found)
+        {
+            setDuration(action,time);
+            loaded++;
+        }
+    }
+    foreach (QString key, sums.keys()) {
+        if(key.startsWith("item:"))
+        {
+            setDuration(key,sums[key]/counts[key]);
+            loaded++;
+        }
+    }
+    qInfo("load cycle trace %s events %d durations %d",file_name.toStdString().c_str(),trace_events.size(),loaded);
+    return true;
+}
+
+void UphSimulator::setDuration(const QString &action, double ms)
+{
+    durations.insert(action,qMax(0.0,ms));
+}
+
+double UphSimulator::duration(const QString &action) const
+{
+    return durations.value(action,0);
+}
+
+void UphSimulator::setFlowchart(const QJsonObject &flowchart)
+{
+    this->flowchart = flowchart;
+}
+
+double UphSimulator::itemDuration(int type, const QString &name, const QJsonValue &properties) const
+{
+    if(durations.contains(QString("item:%1").arg(name)))
+        return durations.value(QString("item:%1").arg(name));
+    switch (type) {
+    case FlowchartGraph::Delay:
+        return properties["params"]["delay_in_ms"].toInt();
+    case FlowchartGraph::InitCamera:
+    case FlowchartGraph::PrToBond:
+    case FlowchartGraph::OC:
+    case FlowchartGraph::OTP:
+        return 1500;
+    case FlowchartGraph::AA:
+        return 6000;
+    case FlowchartGraph::MTF:
+        return 1000;
+    case FlowchartGraph::YLevel:
+        return 800;
+    case FlowchartGraph::UV:
+        return 3000;
+    case FlowchartGraph::Dispense:
+        return 4000;
+    default:
+        return 0;
+    }
+}
+
+double UphSimulator::flowchartDuration()
+{
+    if(durations.value("aa_flowchart") > 0)
+        return durations.value("aa_flowchart");
+    if(flowchart.isEmpty())
+        return 12000;
+    FlowchartGraph graph;
+    QString error;
+    if(!graph.compile(flowchart,error))
+    {
+        qWarning("uph simulation flowchart fail: %s",error.toStdString().c_str());
+        return 12000;
+    }
+    //沿成功路径累加, 分支取最长的一条
+    std::function<double(int,int)> walk = [&](int current, int join) {
+        double time = 0;
+        for (int step = 0; current >= 0&&current != join&&step <= graph.nodeCount(); ++step) {
+            const FlowchartNode &node = graph.node(current);
+            if(!node.branches.isEmpty())
+            {
+                double branch_time = 0;
+                foreach (int branch, node.branches)
+                    branch_time = qMax(branch_time,walk(branch,node.join));
+                time += branch_time;
+                current = node.join;
+                continue;
+            }
+            time += itemDuration(node.type,node.name,node.properties);
+            if(node.terminal)
+                break;
+            current = node.success;
+        }
+        return time;
+    };
+    return walk(graph.node(graph.startNode()).success,-1);
+}
+
+double UphSimulator::sample(const QString &action)
+{
+    double time = active_durations.value(action,0);
+    if(jitter > 0)
+    {
+        std::uniform_real_distribution<double> distribution(-jitter,jitter);
+        time *= 1 + distribution(random);
+    }
+    return qMax(0.0,time);
+}
+
+void UphSimulator::post(const QVariantMap &message)
+{
+    schedule(message_latency,[this,message](){
+        UphSimProcess *target = process_map.value(message["TargetModule"].toString(),nullptr);
+        if(target == nullptr)
+        {
+            qWarning("uph simulation message %s to unknown module %s",message["Message"].toString().toStdString().c_str(),message["TargetModule"].toString().toStdString().c_str());
+            return;
+        }
+        target->receive(message);
+    });
+}
+
+void UphSimulator::schedule(double delay, std::function<void()> action)
+{
+    Event event = {current_time + delay,event_seq++,action};
+    events.push(event);
+}
+
+bool UphSimulator::isNgUnit()
+{
+    if(ng_rate <= 0)
+        return false;
+    std::bernoulli_distribution distribution(qMin(1.0,ng_rate));
+    return distribution(random);
+}
+
+void UphSimulator::finishUnit(bool ng)
+{
+    unit_count_done++;
+    if(ng)
+        ng_count++;
+}
+
+void UphSimulator::reset()
+{
+    qDeleteAll(processes);
+    processes.clear();
+    process_map.clear();
+    events = std::priority_queue<Event>();
+    event_seq = 0;
+    current_time = 0;
+    unit_count_done = 0;
+    ng_count = 0;
+    result_uph = 0;
+}
+
+QString UphSimulator::run(int unit_count)
+{
+    reset();
+    if(unit_count > 0)
+        unit_target = unit_count;
+    random.seed(seed);
+    active_durations = durations;
+    active_durations.insert("aa_flowchart",flowchartDuration());
+    processes << new AAProcess(this,"AA1CoreNew","Sut1Module")
+              << new AAProcess(this,"AA2CoreNew","Sut2Module")
+              << new SutProcess(this,"Sut1Module","AA1CoreNew")
+              << new SutProcess(this,"Sut2Module","AA2CoreNew")
+              << new SensorLoaderProcess(this,"SensorLoaderModule")
+              << new LutProcess(this,"LUTModule")
+              << new LensLoaderProcess(this,"LensLoaderModule")
+              << new TrayLoaderProcess(this,"SensorTrayLoaderModule","sensor_tray_change")
+              << new TrayLoaderProcess(this,"LensTrayLoaderModule","lens_tray_change");
+    foreach (UphSimProcess *process, processes)
+        process_map.insert(process->name,process);
+    foreach (UphSimProcess *process, processes)
+        process->start();
+
+    QElapsedTimer timer; timer.start();
+    qint64 event_count = 0;
+    while (!events.empty()&&unit_count_done < unit_target) {
+        Event event = events.top();
+        events.pop();
+        current_time = event.time;
+        event.action();
+        event_count++;
+    }
+    if(unit_count_done < unit_target)
+        qWarning("uph simulation stopped at %d units, no pending event", unit_count_done);
+    result_uph = current_time > 0?unit_count_done*3600000.0/current_time:0;
+
+    QStringList report;
+    report << QString("simulated %1 units (%2 ng) in %3 s, UPH %4, aa cycle %5 ms, %6 events in %7 ms")
+              .arg(unit_count_done).arg(ng_count).arg(current_time/1000,0,'f',1).arg(result_uph,0,'f',1)
+              .arg(active_durations.value("aa_flowchart"),0,'f',0).arg(event_count).arg(timer.elapsed());
+    foreach (UphSimProcess *process, processes)
+        report << process->report(current_time);
+    foreach (QString line, report)
+        qInfo("%s",line.toStdString().c_str());
+    return report.join("\n");
+}
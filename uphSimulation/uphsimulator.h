@@ -0,0 +1,111 @@
+#ifndef UPHSIMULATOR_H
+#define UPHSIMULATOR_H
+
+#include <QHash>
+#include <QJsonObject>
+#include <QList>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QVariantMap>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+class UphSimProcess;
+
+/*
+ * Discrete-event model of the dual AA machine for predicting UPH.
+ * The sensor loader, lens loader, LUT, both SUTs, both AA heads and the two
+ * tray loaders are processes that exchange the same module messages as the
+ * real modules (LoadSensorRequest, SutReady, FinishLoadSensor,
+ * LoadLensRequest, FinishLoadLens, ChangeTrayResquest, FinishChangeTray).
+ * Every action takes a configured duration, or the average of the matching
+ * spans in an exported cycle trace, with optional jitter. Time only advances
+ * from event to event, so thousands of units are simulated per second.
+ * The report gives UPH, the busy share of every process and where each
+ * process spent its blocked time.
+ */
+class UphSimulator
+{
+public:
+    UphSimulator();
+    ~UphSimulator();
+
+    bool loadConfig(const QString &file_name);
+    bool loadTrace(const QString &file_name);
+    void setDuration(const QString &action, double ms);
+    double duration(const QString &action) const;
+    void setFlowchart(const QJsonObject &flowchart);
+    bool hasFlowchart() const
+    {
+        return !flowchart.isEmpty();
+    }
+    QString run(int unit_count = 0);
+    double uph() const
+    {
+        return result_uph;
+    }
+
+    //供各进程调用
+    double now() const
+    {
+        return current_time;
+    }
+    double sample(const QString &action);
+    void post(const QVariantMap &message);
+    void schedule(double delay, std::function<void()> action);
+    int sensorsPerTray() const
+    {
+        return sensors_per_tray;
+    }
+    int lensesPerTray() const
+    {
+        return lenses_per_tray;
+    }
+    bool isNgUnit();
+    void finishUnit(bool ng);
+
+private:
+    struct Event
+    {
+        double time;
+        qint64 seq;
+        std::function<void()> action;
+        bool operator<(const Event &other) const
+        {
+            //priority_queue取最大, 时间早、序号小的先执行
+            if(time != other.time)
+                return time > other.time;
+            return seq > other.seq;
+        }
+    };
+    void reset();
+    double flowchartDuration();
+    double itemDuration(int type, const QString &name, const QJsonValue &properties) const;
+
+    QMap<QString,double> durations;
+    QMap<QString,double> active_durations;
+    QMap<QString,QStringList> trace_names;
+    QJsonObject flowchart;
+    int unit_target = 1000;
+    int sensors_per_tray = 100;
+    int lenses_per_tray = 100;
+    double jitter = 0;
+    double ng_rate = 0;
+    double message_latency = 1;
+    unsigned int seed = 1;
+
+    std::priority_queue<Event> events;
+    qint64 event_seq = 0;
+    double current_time = 0;
+    std::mt19937 random;
+    QList<UphSimProcess*> processes;
+    QHash<QString,UphSimProcess*> process_map;
+    int unit_count_done = 0;
+    int ng_count = 0;
+    double result_uph = 0;
+};
+
+#endif // UPHSIMULATOR_H
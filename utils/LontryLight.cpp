@@ -2,10 +2,14 @@
 
 LontryLight::LontryLight()
 {
-
+    command_queue.setWriter([this](int ch, int brightness) {
+        return WriteBrightness(ch, (uint16_t)brightness);
+    });
+    command_queue.startThd();
 }
 LontryLight::~LontryLight()
 {
+    command_queue.stopThd();
     if(is_init)
         port.close();
 }
@@ -40,8 +44,25 @@ bool LontryLight::ReInit(const QString &com_port)
 }
 
 
-//example:40 06 01 01 1a 00 00 98 0d 0a is set ch0 bri to 0x98
 bool LontryLight::SetBrightness(int ch, uint16_t brightness)
+{
+    if(ch>9||ch<0)
+        return false;
+    //等本通道排队中的值写完, 保证写入顺序
+    command_queue.waitChannel(ch);
+    return WriteBrightness(ch,brightness);
+}
+
+bool LontryLight::SetBrightnessAsync(int ch, uint16_t brightness)
+{
+    if(ch>9||ch<0||is_init!=true)
+        return false;
+    command_queue.post(ch,brightness);
+    return true;
+}
+
+//example:40 06 01 01 1a 00 00 98 0d 0a is set ch0 bri to 0x98
+bool LontryLight::WriteBrightness(int ch, uint16_t brightness)
 {
     if(is_init!=true)
         return false;
@@ -5,6 +5,7 @@
 #include <QString>
 #include <QObject>
 #include <qmutex.h>
+#include "Drivers/LightSourceController/lightcommandqueue.h"
 
 
 
@@ -31,6 +32,7 @@ public:
     bool Init(const QString &com_port);
     bool ReInit(const QString &com_port);
     bool SetBrightness(int ch, uint16_t brightness);
+    bool SetBrightnessAsync(int ch, uint16_t brightness);
     int GetBrightness(int ch);
     bool SetPWM(int ch,uint16_t pwm);
     bool SetTrigMode(int ch, uint16_t mode);
@@ -66,6 +68,9 @@ private:
 
 
     QMutex cmd_mutex;
+    LightCommandQueue command_queue;
+
+    bool WriteBrightness(int ch, uint16_t brightness);
 
     private slots: void readyReadSlot();
 };
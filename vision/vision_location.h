@@ -1,50 +1,68 @@
-#ifndef VISION_LOCATION_H
-#define VISION_LOCATION_H
-
-#include "utils/pixel2mech.h"
-#include "vision/vision_location_parameter.h"
-#include "vision/visionmodule.h"
-#include "vision/wordoplight.h"
-
-class VisionLocation:public ErrorBase
-{
-public:
-    VisionLocation();
-    void Init(VisionModule* vison,Pixel2Mech* mapping,WordopLight* lighting);
-    void loadParam();
-    void saveParam();
-    bool performPR(PrOffset &offset, bool need_conversion = true);
-    bool performPR();
-    bool performNoMaterialPR();
-    bool performPR(PRResultStruct &pr_result);
-    bool performGlueInspection(QString beforeDispenseImageName, QString afterDispenseImageName, QString *glueInspectionImageName,
-                               double min_glue_width, double max_glue_width, double avg_glue_width,
-                               double &outMinGlueWidth, double &outMaxGlueWidth, double &outMaxAvgGlueWidth);
-    void resetResult();
-    QPointF getCurrentOffset();
-
-    PrOffset getCurrentResult();
-    void setCurrentResult(PrOffset pr_offset);
-    PrOffset getCurrentResult(bool use_origin);
-    QPointF getCurrentResultOffset();
-    QPointF getOffsetResult(QPoint offset);
-    PRResultStruct getCurrentPixelResult();
-
-    void OpenLight();
-    void CloseLight();
-    void OpenLight(int channel, uint8_t brightness);
-    void CloseLight(int channel);
-    QString getLastImageName();
-    bool saveImage(QString imageName);
-public:
-    VisionLocationParameter parameters;
-private:
-    QString last_image_name = "";
-    VisionModule* vison;
-    Pixel2Mech* mapping;
-    WordopLight* lighting;
-    PrOffset current_result;
-    PRResultStruct current_pixel_result;
-};
-
-#endif // VISION_LOCATION_H
+#ifndef VISION_LOCATION_H
+#define VISION_LOCATION_H
+
+#include "utils/pixel2mech.h"
+#include "vision/vision_location_parameter.h"
+#include "vision/visionmodule.h"
+#include "vision/wordoplight.h"
+
+class VisionLocation:public ErrorBase
+{
+public:
+    VisionLocation();
+    void Init(VisionModule* vison,Pixel2Mech* mapping,WordopLight* lighting);
+    void loadParam();
+    void saveParam();
+    bool performPR(PrOffset &offset, bool need_conversion = true);
+    bool performPR();
+    bool performNoMaterialPR();
+    bool performPR(PRResultStruct &pr_result);
+    bool performMultiPR(QVector<PrOffset> &offsets, double min_distance);
+    bool performGlueInspection(QString beforeDispenseImageName, QString afterDispenseImageName, QString *glueInspectionImageName,
+                               double min_glue_width, double max_glue_width, double avg_glue_width,
+                               double &outMinGlueWidth, double &outMaxGlueWidth, double &outMaxAvgGlueWidth);
+    void resetResult();
+    QPointF getCurrentOffset();
+
+    PrOffset getCurrentResult();
+    void setCurrentResult(PrOffset pr_offset);
+    PrOffset getCurrentResult(bool use_origin);
+    QPointF getCurrentResultOffset();
+    QPointF getOffsetResult(QPoint offset);
+    PRResultStruct getCurrentPixelResult();
+
+    void OpenLight();
+    void PreOpenLight();
+    void CloseLight();
+    void OpenLight(int channel, uint8_t brightness);
+    void CloseLight(int channel);
+    QString getLastImageName();
+    bool saveImage(QString imageName);
+    void resetSearchPrediction();
+    bool startTriggeredCapture();
+    void stopTriggeredCapture();
+    int triggeredImageCount();
+    bool waitTriggeredImage(int timeout);
+public:
+    VisionLocationParameter parameters;
+private:
+    ErrorCodeStruct performGenericPR(PRResultStruct &pr_result);
+    void waitImageReady();
+    QRectF getPredictedSearchWindow();
+    void updateSearchPrediction(const PRResultStruct &pr_result);
+    QString last_image_name = "";
+    VisionModule* vison;
+    Pixel2Mech* mapping;
+    WordopLight* lighting;
+    PrOffset current_result;
+    PRResultStruct current_pixel_result;
+    const static int PREDICT_WINDOW_LENGTH = 8;
+    int predict_samples = 0;
+    QPointF predict_center;
+    QPointF predict_deviation;
+    int predict_hit_count = 0;
+    int predict_miss_count = 0;
+    bool triggered_capture = false;
+};
+
+#endif // VISION_LOCATION_H
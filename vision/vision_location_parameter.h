@@ -38,6 +38,10 @@ public:
     Q_PROPERTY(double smallCircleRadiusMin READ smallCircleRadiusMin WRITE setSmallCircleRadiusMin NOTIFY smallCircleRadiusMinChanged)
     Q_PROPERTY(int retryCount READ retryCount WRITE setRetryCount NOTIFY retryCountChanged)
     Q_PROPERTY(bool closeLightAfterPR READ closeLightAfterPR WRITE setCloseLightAfterPR NOTIFY closeLightAfterPRChanged)
+    Q_PROPERTY(bool usePredictiveSearch READ usePredictiveSearch WRITE setUsePredictiveSearch NOTIFY usePredictiveSearchChanged)
+    Q_PROPERTY(double predictiveSearchMargin READ predictiveSearchMargin WRITE setPredictiveSearchMargin NOTIFY predictiveSearchMarginChanged)
+    Q_PROPERTY(int predictiveMinSamples READ predictiveMinSamples WRITE setPredictiveMinSamples NOTIFY predictiveMinSamplesChanged)
+    Q_PROPERTY(bool residualImageDelay READ residualImageDelay WRITE setResidualImageDelay NOTIFY residualImageDelayChanged)
 
     QString prFileName() const
     {
@@ -185,6 +189,26 @@ public:
         return m_smallCircleRadiusMin;
     }
 
+    bool usePredictiveSearch() const
+    {
+        return m_usePredictiveSearch;
+    }
+
+    double predictiveSearchMargin() const
+    {
+        return m_predictiveSearchMargin;
+    }
+
+    int predictiveMinSamples() const
+    {
+        return m_predictiveMinSamples;
+    }
+
+    bool residualImageDelay() const
+    {
+        return m_residualImageDelay;
+    }
+
 public slots:
     void setPrFileName(QString prFileName)
     {
@@ -449,6 +473,42 @@ public slots:
         emit smallCircleRadiusMinChanged(m_smallCircleRadiusMin);
     }
 
+    void setUsePredictiveSearch(bool usePredictiveSearch)
+    {
+        if (m_usePredictiveSearch == usePredictiveSearch)
+            return;
+
+        m_usePredictiveSearch = usePredictiveSearch;
+        emit usePredictiveSearchChanged(m_usePredictiveSearch);
+    }
+
+    void setPredictiveSearchMargin(double predictiveSearchMargin)
+    {
+        if (qFuzzyCompare(m_predictiveSearchMargin, predictiveSearchMargin))
+            return;
+
+        m_predictiveSearchMargin = predictiveSearchMargin;
+        emit predictiveSearchMarginChanged(m_predictiveSearchMargin);
+    }
+
+    void setPredictiveMinSamples(int predictiveMinSamples)
+    {
+        if (m_predictiveMinSamples == predictiveMinSamples)
+            return;
+
+        m_predictiveMinSamples = predictiveMinSamples;
+        emit predictiveMinSamplesChanged(m_predictiveMinSamples);
+    }
+
+    void setResidualImageDelay(bool residualImageDelay)
+    {
+        if (m_residualImageDelay == residualImageDelay)
+            return;
+
+        m_residualImageDelay = residualImageDelay;
+        emit residualImageDelayChanged(m_residualImageDelay);
+    }
+
 signals:
     void prFileNameChanged(QString prFileName);
 
@@ -508,6 +568,14 @@ signals:
 
     void smallCircleRadiusMinChanged(double smallCircleRadiusMin);
 
+    void usePredictiveSearchChanged(bool usePredictiveSearch);
+
+    void predictiveSearchMarginChanged(double predictiveSearchMargin);
+
+    void predictiveMinSamplesChanged(int predictiveMinSamples);
+
+    void residualImageDelayChanged(bool residualImageDelay);
+
 private:
     QString m_prFileName = "";
     QString m_cameraName = "";
@@ -538,6 +606,10 @@ private:
     double m_smallCircleRadiusMax = 7;
     double m_smallCircleRadiusMin = 6;
     int m_retryCount = 3;
+    bool m_usePredictiveSearch = false;
+    double m_predictiveSearchMargin = 40;
+    int m_predictiveMinSamples = 3;
+    bool m_residualImageDelay = false;
 };
 
 
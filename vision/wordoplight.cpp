@@ -1,22 +1,34 @@
 ﻿#include "vision/wordoplight.h"
 #include <QMutexLocker>
 #include <QThread>
+#include <limits>
 #include "utils/commonutils.h"
 WordopLight::WordopLight(int mode, QString name):ThreadWorkerBase(name)
 {
     this->mode = mode;
     port_name = "";
+    change_clock.start();
+    for (int i = 0; i < 10; i++)
+        change_time[i].store(-1);
     Init("com1");
     OnOff(0, true);
     OnOff(1, true);
     OnOff(2, true);
     OnOff(3, true);
+    command_queue.setWriter([this](int ch, int brightness) {
+        QMutexLocker locker(&cmd_mutex);
+        change_result = false;
+        ChangeBrightness(ch, (uint8_t)brightness);
+        return change_result;
+    });
+    command_queue.startThd();
     //connect(this,&WordopLight::ChangeBrightnessSignal,this,&WordopLight::ChangeBrightness,Qt::QueuedConnection);
     //connect(this,&WordopLight::ChangeDoneSignal,this,&WordopLight::ChangeDone,Qt::QueuedConnection);
 }
 
 WordopLight::~WordopLight()
 {
+    command_queue.stopThd();
     if(is_init)
       port.close();
 }
@@ -55,30 +67,36 @@ bool WordopLight::ReInit(const QString &com_port) {
 
 bool WordopLight::setBrightness(int ch, uint8_t brightness)
 {
+    if((ch>9)||(ch<0))
+        return false;
+    //only wait for the value still queued on this channel, the cached brightness is up to date after it
+    command_queue.waitChannel(ch);
+    QMutexLocker locker(&cmd_mutex);
     if(now_brightness[ch] == brightness)
         return true;
-    if(QThread::currentThreadId()==creator_tid)
-    {
-        change_result = false;
-        ChangeBrightness(ch,brightness);
-        return change_result;
-    }
-    QMutexLocker locker(&cmd_mutex);
     change_result = false;
-    change_done = false;
-
     ChangeBrightness(ch,brightness);
-    //emit ChangeBrightnessSignal(ch,brightness);
+    return change_result;
+}
+
+qint64 WordopLight::msSinceChanged(int ch)
+{
+    if((ch>9)||(ch<0))
+        return std::numeric_limits<qint64>::max();
+    qint64 time = change_time[ch].load();
+    if(time<0)
+        return std::numeric_limits<qint64>::max();
+    return change_clock.elapsed() - time;
+}
+
+bool WordopLight::setBrightnessAsync(int ch, uint8_t brightness)
+{
+    if((ch>9)||(ch<0)||(is_init!=true))
+        return false;
+    if(now_brightness[ch] == brightness&&(!command_queue.isPending(ch)))
+        return true;
+    command_queue.post(ch, brightness);
     return true;
-    int timeout = 1000;
-    while(timeout>0)
-    {
-        if(change_done)
-            return change_result;
-        QThread::msleep(10);
-        timeout-=10;
-    }
-    return false;
 }
 
 int WordopLight::GetBrightness(int ch)
@@ -176,6 +194,7 @@ void WordopLight::ChangeBrightness(int ch, uint8_t brightness)
             if(bres)
                {
                 now_brightness[ch] = brightness;
+                change_time[ch].store(change_clock.elapsed());
                 change_result = true;
                 return;
                 if(QThread::currentThreadId()==creator_tid)
@@ -1,11 +1,14 @@
 ﻿#ifndef WORDOPLIGHT_H
 #define WORDOPLIGHT_H
 #include <QSerialPort>
+#include <QElapsedTimer>
 #include <QString>
 #include <QObject>
 #include <qmutex.h>
+#include <atomic>
 #include "config.h"
 #include "thread_worker_base.h"
+#include "Drivers/LightSourceController/lightcommandqueue.h"
 
 typedef enum {
     LIGHTING_UPLOOK,
@@ -57,7 +60,9 @@ public:
     bool Init(const QString &com_port);
     bool ReInit(const QString &com_port);
     bool setBrightness(int ch, uint8_t brightness);
+    bool setBrightnessAsync(int ch, uint8_t brightness);
     int GetBrightness(int ch);
+    qint64 msSinceChanged(int ch);
     bool SetPWM(int ch,uint8_t pwm);
     bool SetTrigMode(int ch, uint8_t mode);
     bool OnOff(int ch, bool on_or_off);
@@ -306,6 +311,10 @@ private:
     bool change_result = false;
 
     uint8_t now_brightness[10]={0};
+    QElapsedTimer change_clock;
+    //queue thread writes, callers of msSinceChanged read
+    std::atomic<qint64> change_time[10];
+    LightCommandQueue command_queue;
 
     int m_downlookLighting = 0;
     int m_downlookCoaxialLighting = 0;
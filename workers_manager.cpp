@@ -408,12 +408,17 @@ void WorkersManager::stopWorkers(bool wait_finish)
     run_parameter.clear();
     qInfo("stop all worker");
     emit stopWorkersSignal(wait_finish);
+    //停止后唤醒各模块中的等待
+    foreach (ThreadWorkerBase *worker, workers)
+        worker->interruptWaits();
 }
 
 void WorkersManager::resetLogics()
 {
     qInfo("reset all logics");
     emit resetLogicsSignal();
+    foreach (ThreadWorkerBase *worker, workers)
+        worker->interruptWaits();
 }
 
 void WorkersManager::startWorker(QString name,int run_mode)
@@ -440,6 +445,7 @@ void WorkersManager::stopWorker(QString name, bool wait_finish)
         current_name = name;
     }
     emit stopWorkerSignal(wait_finish);
+    workers[name]->interruptWaits();
 }
 
 void WorkersManager::resetLogic(QString name)
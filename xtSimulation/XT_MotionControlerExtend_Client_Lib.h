@@ -0,0 +1,70 @@
+#ifndef XT_MOTIONCONTROLEREXTEND_CLIENT_LIB_H
+#define XT_MOTIONCONTROLEREXTEND_CLIENT_LIB_H
+
+/*
+ * Simulated XT controller extend interface, see XT_MotionControler_Client_Lib.h.
+ * The profile name lookups take the QString utf16 buffer the callers pass,
+ * the returned names point into the simulator and stay valid until the next
+ * Profile_Load.
+ */
+
+#include "XT_MotionControler_Client_Lib.h"
+
+namespace XT_Controler_Extend
+{
+    int Profile_Load(LPWSTR file_path);
+    int Profile_Init_Controller(int mode);
+    int Profile_Get_IoIn_Count();
+    int Profile_Get_IoOut_Count();
+    int Profile_Get_Axis_Count();
+    LPWSTR Profile_Get_IoIn_Name(int io_id);
+    LPWSTR Profile_Get_IoOut_Name(int io_id);
+    LPWSTR Profile_Get_Axis_Name(int axis_id);
+    int Profile_Find_IoIn_Name(LPWSTR name);
+    int Profile_Find_IoOut_Name(LPWSTR name);
+    int Profile_Find_Axis_Name(LPWSTR name);
+    int Profile_Get_Axis_Master(int axis_id);
+    int Profile_Get_Axis_Enable_Output_ID(int axis_id);
+    int Profile_Get_Axis_ClrAlm_Output_ID(int axis_id);
+    int Profile_Get_Axis_InPos_Input_ID(int axis_id);
+    int Profile_Get_Axis_Alarm_Input_ID(int axis_id);
+    int Profile_Get_Axis_Ready_Input_ID(int axis_id);
+    double Profile_Get_Axis_Vel(int axis_id);
+    double Profile_Get_Axis_Acc(int axis_id);
+    double Profile_Get_Axis_Jerk(int axis_id);
+    double Profile_Get_Axis_MaxPos(int axis_id);
+    double Profile_Get_Axis_MinPos(int axis_id);
+    int PROFILE_AXIS_SEEK_ORIGIN(int thread, int axis_id);
+
+    int Stop_Buffer_Sync();
+    int Start_Buffer_Sync(int thread);
+
+    int Get_Cur_Axis_Pos(int axis_id, double &pos);
+    int Get_Cur_Axis_Vel(int axis_id, double &vel);
+    int Get_Cur_Axis_Acc(int axis_id, double &acc);
+    int Get_Cur_Axis_State(int axis_id, int &be_run);
+    int Set_Axis_Bind(int axis_id, int master_axis_id, int numerator, int denominator);
+    int Set_Axis_Delay(int axis_id, double delay);
+    int SGO_INCREASE_LIMIT(int thread, int axis_id, double step, double limit);
+
+    int Get_IoIn_State(int io_id, int &state);
+    int Get_IoOut_State(int io_id, int &state);
+    int DigitOut_PreciousTrig_SetCurIoOutput(int io_id, int value);
+    int DIGITOUT_PRECIOUTTRIG_SET_OUTPUT_IO(int thread, int io_id, int delay, int value);
+    int Set_Axis_Trig_Output(int axis_id, int reverse, double trig_pos, double delay, int count, int io_id, int value, int mode);
+    int Clear_Axis_Trig(int axis_id);
+
+    int Encoder_Init(int can_id, int channel, int &encoder_id);
+    int Encoder_Read_Value(int encoder_id, long long &value);
+    int Encoder_Write_Value(int encoder_id, long long value);
+
+    int Set_Curve_Param(int curve_id, double cycle, int dem, int *axis, double *max_vel, double *max_acc, double *max_jerk, int *axis_combine);
+    int Append_Line_Pos(int curve_id, int dem, int *axis, double *pos, double max_vel, double end_vel, int mode, int &point_index);
+    double Curve_Get_LengthPos(int curve_id, int point_index);
+    int Set_Cur_Trig_Output(int curve_id, int mode, double distance, double delay, int io_id, int value);
+    int Exec_Curve(int curve_id, int thread, int trig_thread, int count);
+    int Check_Finish(int curve_id);
+    int Clear_Exec(int curve_id);
+}
+
+#endif // XT_MOTIONCONTROLEREXTEND_CLIENT_LIB_H
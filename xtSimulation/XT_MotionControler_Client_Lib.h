@@ -0,0 +1,63 @@
+#ifndef XT_MOTIONCONTROLER_CLIENT_LIB_H
+#define XT_MOTIONCONTROLER_CLIENT_LIB_H
+
+/*
+ * Simulated XT motion controller interface.
+ * Only built with CONFIG+=xt_simulation, it replaces the header of the
+ * MotionControlDll and declares the entry points used by this program;
+ * the instructions are executed by XtSimulator.
+ */
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+typedef wchar_t *LPWSTR;
+#endif
+#include <stdint.h>
+
+namespace XT_Controler
+{
+    enum XT_DataType
+    {
+        datatype_int32 = 0,
+        datatype_float32 = 1
+    };
+
+    int InitDevice_PC_Local_Controler(int mode);
+    int beCurConnectServerAndInterfaceBoard();
+    int ConnectControlServer(LPWSTR ip, int port, int timeout);
+    int ReBuildSystem();
+
+    int WaitForAllInsFinish(int thread);
+    int GetThreadInsBufferRemainCount(int thread, int &remain_count, int &finish);
+    int ClearInsBuffer(int thread);
+
+    int SetCurIoOutput(int io_id, int value);
+    int SET_OUTPUT_IO(int thread, int io_id, int value);
+    int GET_INPUT_IO(int thread, int io_id, int reg_id);
+    int TILLIO(int thread, int io_id);
+    int TILLIO_NEG(int thread, int io_id);
+    int TILLTIME(int thread, int ms);
+
+    int SGO(int thread, int axis_id, double pos);
+    int SGO_R(int thread, int axis_id, int reg_id);
+    int TILLSTOP(int thread, int axis_id);
+    int STOP_S(int thread, int axis_id);
+    int STOP_T(int thread, int axis_id);
+    int SET_MAX_VEL(int thread, int axis_id, double vel);
+    int SET_MAX_ACC(int thread, int axis_id, double acc);
+    int SET_MAX_JERK(int thread, int axis_id, double jerk);
+    int SET_AXIS_ZEROS(int thread, int axis_id, double pos);
+
+    int USE_LOCAL_REG(int thread);
+    int GET_OUTPUT_POS(int thread, int axis_id, int reg_id);
+    int ADD_R_C(int thread, int dst_reg_id, int src_reg_id, double value);
+    int CONDITION_NEG_JMP(int thread, int reg_id, double value, int skip_count);
+    int ReadControlerRegVal(int thread, int first_reg_id, int last_reg_id, double *values);
+
+    int SET_INPUT_DATA_MAP(int thread, int can_id, int channel, int data_type, int data_channel_id);
+    int RESET_INPUT_DATA_FIFO(int thread, int data_channel_id, int depth);
+    int GetInputChannelData(int data_channel_id, int max_count, int &count, double *data, uint64_t *data_order);
+}
+
+#endif // XT_MOTIONCONTROLER_CLIENT_LIB_H
@@ -0,0 +1,441 @@
+#include "XT_MotionControler_Client_Lib.h"
+#include "XT_MotionControlerExtend_Client_Lib.h"
+#include "xtsimulator.h"
+
+namespace
+{
+    XtSimulator::Instruction instruction(XtSimulator::InstructionType type, int id, int reg = 0, double value = 0, double limit = 0)
+    {
+        XtSimulator::Instruction result;
+        result.type = type;
+        result.id = id;
+        result.reg = reg;
+        result.value = value;
+        result.limit = limit;
+        return result;
+    }
+
+    int append(int thread, const XtSimulator::Instruction &ins)
+    {
+        return XtSimulator::instance()->append(thread, ins);
+    }
+
+    //调用者传入的是QString::utf16()
+    QString nameFromCaller(LPWSTR name)
+    {
+        return QString::fromUtf16(reinterpret_cast<const ushort*>(name));
+    }
+}
+
+namespace XT_Controler
+{
+    int InitDevice_PC_Local_Controler(int)
+    {
+        return 1;
+    }
+
+    int beCurConnectServerAndInterfaceBoard()
+    {
+        return 1;
+    }
+
+    int ConnectControlServer(LPWSTR, int, int)
+    {
+        return 1;
+    }
+
+    int ReBuildSystem()
+    {
+        return 1;
+    }
+
+    int WaitForAllInsFinish(int thread)
+    {
+        return XtSimulator::instance()->waitAllFinish(thread);
+    }
+
+    int GetThreadInsBufferRemainCount(int thread, int &remain_count, int &finish)
+    {
+        return XtSimulator::instance()->remainCount(thread, remain_count, finish);
+    }
+
+    int ClearInsBuffer(int thread)
+    {
+        return XtSimulator::instance()->clearThread(thread);
+    }
+
+    int SetCurIoOutput(int io_id, int value)
+    {
+        return XtSimulator::instance()->setOutput(io_id, value);
+    }
+
+    int SET_OUTPUT_IO(int thread, int io_id, int value)
+    {
+        return append(thread, instruction(XtSimulator::INS_SET_OUTPUT, io_id, 0, value));
+    }
+
+    int GET_INPUT_IO(int thread, int io_id, int reg_id)
+    {
+        return append(thread, instruction(XtSimulator::INS_GET_INPUT, io_id, reg_id));
+    }
+
+    int TILLIO(int thread, int io_id)
+    {
+        return append(thread, instruction(XtSimulator::INS_TILL_IO, io_id));
+    }
+
+    int TILLIO_NEG(int thread, int io_id)
+    {
+        return append(thread, instruction(XtSimulator::INS_TILL_IO_NEG, io_id));
+    }
+
+    int TILLTIME(int thread, int ms)
+    {
+        return append(thread, instruction(XtSimulator::INS_TILL_TIME, 0, 0, ms));
+    }
+
+    int SGO(int thread, int axis_id, double pos)
+    {
+        return append(thread, instruction(XtSimulator::INS_SGO, axis_id, 0, pos));
+    }
+
+    int SGO_R(int thread, int axis_id, int reg_id)
+    {
+        return append(thread, instruction(XtSimulator::INS_SGO_R, axis_id, reg_id));
+    }
+
+    int TILLSTOP(int thread, int axis_id)
+    {
+        return append(thread, instruction(XtSimulator::INS_TILL_STOP, axis_id));
+    }
+
+    int STOP_S(int thread, int axis_id)
+    {
+        return append(thread, instruction(XtSimulator::INS_STOP_S, axis_id));
+    }
+
+    int STOP_T(int thread, int axis_id)
+    {
+        return append(thread, instruction(XtSimulator::INS_STOP_T, axis_id));
+    }
+
+    int SET_MAX_VEL(int thread, int axis_id, double vel)
+    {
+        return append(thread, instruction(XtSimulator::INS_SET_VEL, axis_id, 0, vel));
+    }
+
+    int SET_MAX_ACC(int thread, int axis_id, double acc)
+    {
+        return append(thread, instruction(XtSimulator::INS_SET_ACC, axis_id, 0, acc));
+    }
+
+    int SET_MAX_JERK(int thread, int axis_id, double jerk)
+    {
+        return append(thread, instruction(XtSimulator::INS_SET_JERK, axis_id, 0, jerk));
+    }
+
+    int SET_AXIS_ZEROS(int thread, int axis_id, double pos)
+    {
+        return append(thread, instruction(XtSimulator::INS_SET_ZERO, axis_id, 0, pos));
+    }
+
+    int USE_LOCAL_REG(int)
+    {
+        return 1;
+    }
+
+    int GET_OUTPUT_POS(int thread, int axis_id, int reg_id)
+    {
+        return append(thread, instruction(XtSimulator::INS_GET_OUTPUT_POS, axis_id, reg_id));
+    }
+
+    int ADD_R_C(int thread, int dst_reg_id, int src_reg_id, double value)
+    {
+        return append(thread, instruction(XtSimulator::INS_ADD_R_C, src_reg_id, dst_reg_id, value));
+    }
+
+    int CONDITION_NEG_JMP(int thread, int reg_id, double value, int skip_count)
+    {
+        return append(thread, instruction(XtSimulator::INS_CONDITION_NEG_JMP, 0, reg_id, value, skip_count));
+    }
+
+    int ReadControlerRegVal(int thread, int first_reg_id, int last_reg_id, double *values)
+    {
+        for (int i = first_reg_id; i <= last_reg_id; i++)
+            values[i - first_reg_id] = XtSimulator::instance()->readRegister(thread, i);
+        return 1;
+    }
+
+    //模拟器没有ADC数据
+    int SET_INPUT_DATA_MAP(int, int, int, int, int)
+    {
+        return 1;
+    }
+
+    int RESET_INPUT_DATA_FIFO(int, int, int)
+    {
+        return 1;
+    }
+
+    int GetInputChannelData(int, int, int &count, double *, uint64_t *)
+    {
+        count = 0;
+        return 1;
+    }
+}
+
+namespace XT_Controler_Extend
+{
+    int Profile_Load(LPWSTR file_path)
+    {
+        return XtSimulator::instance()->loadProfile(QString::fromWCharArray(file_path)) ? 1 : 0;
+    }
+
+    int Profile_Init_Controller(int)
+    {
+        XtSimulator::instance()->startThd();
+        return 1;
+    }
+
+    int Profile_Get_IoIn_Count()
+    {
+        return XtSimulator::instance()->inputCount();
+    }
+
+    int Profile_Get_IoOut_Count()
+    {
+        return XtSimulator::instance()->outputCount();
+    }
+
+    int Profile_Get_Axis_Count()
+    {
+        return XtSimulator::instance()->axisCount();
+    }
+
+    LPWSTR Profile_Get_IoIn_Name(int io_id)
+    {
+        return const_cast<LPWSTR>(XtSimulator::instance()->inputName(io_id));
+    }
+
+    LPWSTR Profile_Get_IoOut_Name(int io_id)
+    {
+        return const_cast<LPWSTR>(XtSimulator::instance()->outputName(io_id));
+    }
+
+    LPWSTR Profile_Get_Axis_Name(int axis_id)
+    {
+        return const_cast<LPWSTR>(XtSimulator::instance()->axisName(axis_id));
+    }
+
+    int Profile_Find_IoIn_Name(LPWSTR name)
+    {
+        return XtSimulator::instance()->findInput(nameFromCaller(name));
+    }
+
+    int Profile_Find_IoOut_Name(LPWSTR name)
+    {
+        return XtSimulator::instance()->findOutput(nameFromCaller(name));
+    }
+
+    int Profile_Find_Axis_Name(LPWSTR name)
+    {
+        return XtSimulator::instance()->findAxis(nameFromCaller(name));
+    }
+
+    int Profile_Get_Axis_Master(int)
+    {
+        return -1;
+    }
+
+    //模拟的伺服没有使能、清报警、到位、报警和就绪IO
+    int Profile_Get_Axis_Enable_Output_ID(int)
+    {
+        return -1;
+    }
+
+    int Profile_Get_Axis_ClrAlm_Output_ID(int)
+    {
+        return -1;
+    }
+
+    int Profile_Get_Axis_InPos_Input_ID(int)
+    {
+        return -1;
+    }
+
+    int Profile_Get_Axis_Alarm_Input_ID(int)
+    {
+        return -1;
+    }
+
+    int Profile_Get_Axis_Ready_Input_ID(int)
+    {
+        return -1;
+    }
+
+    double Profile_Get_Axis_Vel(int axis_id)
+    {
+        return XtSimulator::instance()->axisParameter(axis_id, XtSimulator::AXIS_MAX_VEL);
+    }
+
+    double Profile_Get_Axis_Acc(int axis_id)
+    {
+        return XtSimulator::instance()->axisParameter(axis_id, XtSimulator::AXIS_MAX_ACC);
+    }
+
+    double Profile_Get_Axis_Jerk(int axis_id)
+    {
+        return XtSimulator::instance()->axisParameter(axis_id, XtSimulator::AXIS_MAX_JERK);
+    }
+
+    double Profile_Get_Axis_MaxPos(int axis_id)
+    {
+        return XtSimulator::instance()->axisParameter(axis_id, XtSimulator::AXIS_MAX_POS);
+    }
+
+    double Profile_Get_Axis_MinPos(int axis_id)
+    {
+        return XtSimulator::instance()->axisParameter(axis_id, XtSimulator::AXIS_MIN_POS);
+    }
+
+    int PROFILE_AXIS_SEEK_ORIGIN(int thread, int axis_id)
+    {
+        return append(thread, instruction(XtSimulator::INS_SEEK_ORIGIN, axis_id));
+    }
+
+    int Stop_Buffer_Sync()
+    {
+        return 1;
+    }
+
+    int Start_Buffer_Sync(int)
+    {
+        return 1;
+    }
+
+    int Get_Cur_Axis_Pos(int axis_id, double &pos)
+    {
+        double vel, acc;
+        bool running;
+        return XtSimulator::instance()->axisState(axis_id, pos, vel, acc, running);
+    }
+
+    int Get_Cur_Axis_Vel(int axis_id, double &vel)
+    {
+        double pos, acc;
+        bool running;
+        return XtSimulator::instance()->axisState(axis_id, pos, vel, acc, running);
+    }
+
+    int Get_Cur_Axis_Acc(int axis_id, double &acc)
+    {
+        double pos, vel;
+        bool running;
+        return XtSimulator::instance()->axisState(axis_id, pos, vel, acc, running);
+    }
+
+    int Get_Cur_Axis_State(int axis_id, int &be_run)
+    {
+        double pos, vel, acc;
+        bool running = false;
+        int res = XtSimulator::instance()->axisState(axis_id, pos, vel, acc, running);
+        be_run = running ? 1 : 0;
+        return res;
+    }
+
+    int Set_Axis_Bind(int, int, int, int)
+    {
+        return 1;
+    }
+
+    int Set_Axis_Delay(int, double)
+    {
+        return 1;
+    }
+
+    int SGO_INCREASE_LIMIT(int thread, int axis_id, double step, double limit)
+    {
+        return append(thread, instruction(XtSimulator::INS_SGO_INCREASE_LIMIT, axis_id, 0, step, limit));
+    }
+
+    int Get_IoIn_State(int io_id, int &state)
+    {
+        return XtSimulator::instance()->inputState(io_id, state);
+    }
+
+    int Get_IoOut_State(int io_id, int &state)
+    {
+        return XtSimulator::instance()->outputState(io_id, state);
+    }
+
+    int DigitOut_PreciousTrig_SetCurIoOutput(int io_id, int value)
+    {
+        return XtSimulator::instance()->setOutput(io_id, value);
+    }
+
+    int DIGITOUT_PRECIOUTTRIG_SET_OUTPUT_IO(int thread, int io_id, int, int value)
+    {
+        return append(thread, instruction(XtSimulator::INS_SET_OUTPUT, io_id, 0, value));
+    }
+
+    int Set_Axis_Trig_Output(int axis_id, int reverse, double trig_pos, double, int, int io_id, int value, int)
+    {
+        return XtSimulator::instance()->setAxisTrig(axis_id, reverse != 0, trig_pos, io_id, value);
+    }
+
+    int Clear_Axis_Trig(int axis_id)
+    {
+        return XtSimulator::instance()->clearAxisTrig(axis_id);
+    }
+
+    //编码器不和轴关联, 读回最后写入的值
+    int Encoder_Init(int, int, int &)
+    {
+        return 1;
+    }
+
+    int Encoder_Read_Value(int encoder_id, long long &value)
+    {
+        return XtSimulator::instance()->encoderValue(encoder_id, value);
+    }
+
+    int Encoder_Write_Value(int encoder_id, long long value)
+    {
+        return XtSimulator::instance()->setEncoderValue(encoder_id, value);
+    }
+
+    int Set_Curve_Param(int curve_id, double, int dem, int *axis, double *, double *max_acc, double *, int *)
+    {
+        return XtSimulator::instance()->setCurveParam(curve_id, dem, axis, max_acc);
+    }
+
+    int Append_Line_Pos(int curve_id, int dem, int *axis, double *pos, double max_vel, double end_vel, int, int &point_index)
+    {
+        return XtSimulator::instance()->appendCurvePoint(curve_id, dem, axis, pos, max_vel, end_vel, point_index);
+    }
+
+    double Curve_Get_LengthPos(int curve_id, int point_index)
+    {
+        return XtSimulator::instance()->curveLength(curve_id, point_index);
+    }
+
+    int Set_Cur_Trig_Output(int curve_id, int mode, double distance, double, int io_id, int value)
+    {
+        return XtSimulator::instance()->setCurveTrig(curve_id, mode, distance, io_id, value);
+    }
+
+    int Exec_Curve(int curve_id, int thread, int, int)
+    {
+        return append(thread, instruction(XtSimulator::INS_EXEC_CURVE, curve_id));
+    }
+
+    int Check_Finish(int curve_id)
+    {
+        return XtSimulator::instance()->curveFinished(curve_id);
+    }
+
+    int Clear_Exec(int curve_id)
+    {
+        return XtSimulator::instance()->clearCurve(curve_id);
+    }
+}
@@ -0,0 +1,984 @@
+#include "xtsimulator.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QTextStream>
+#include <QStringList>
+#include <qmath.h>
+
+XtSimulator::XtSimulator()
+{
+    bool ok = false;
+    double env_scale = qgetenv("XT_SIM_TIME_SCALE").toDouble(&ok);
+    if(ok && env_scale > 0)
+        scale = env_scale;
+    //XT_SIM_SETTLE=振幅,频率Hz,衰减时间常数ms
+    QStringList settle = QString::fromLocal8Bit(qgetenv("XT_SIM_SETTLE")).split(',');
+    if(settle.size() == 3)
+        setSettleOscillation(settle[0].toDouble(), settle[1].toDouble(), settle[2].toDouble());
+    clock.start();
+}
+
+XtSimulator::~XtSimulator()
+{
+    stopThd();
+}
+
+XtSimulator *XtSimulator::instance()
+{
+    static XtSimulator simulator;
+    return &simulator;
+}
+
+void XtSimulator::startThd()
+{
+    if(isRunning())
+        return;
+    isRun = true;
+    this->start(QThread::HighPriority);
+}
+
+void XtSimulator::stopThd()
+{
+    locker.lock();
+    isRun = false;
+    locker.unlock();
+    this->wait();
+}
+
+bool XtSimulator::loadProfile(const QString &file_path)
+{
+    QFile file(file_path);
+    if(!file.open(QIODevice::ReadOnly))
+    {
+        qWarning("XtSimulator open profile %s fail", file_path.toStdString().c_str());
+        return false;
+    }
+    QTextStream stream(&file);
+    stream.setCodec("GBK");
+
+    QVector<Axis> new_axes;
+    QVector<std::wstring> new_inputs;
+    QVector<std::wstring> new_outputs;
+    QMap<QString, double> home_vels;
+    while (!stream.atEnd()) {
+        //每行为 类型=名称,键=值,...
+        QStringList fields = stream.readLine().split(',');
+        QString type, name;
+        QMap<QString, QString> values;
+        foreach (QString field, fields) {
+            int index = field.indexOf('=');
+            if(index < 0)
+                continue;
+            QString key = field.left(index).trimmed();
+            QString value = field.mid(index + 1).trimmed();
+            if(type.isEmpty())
+            {
+                type = key;
+                name = value;
+            }
+            values[key] = value;
+        }
+        if(type == u8"轴")
+        {
+            Axis axis;
+            axis.name = name.toStdWString();
+            axis.minPos = values.value(u8"最小位置").toDouble();
+            axis.maxPos = values.value(u8"最大位置").toDouble();
+            axis.profileVel = values.value(u8"最大速度").toDouble();
+            axis.profileAcc = values.value(u8"加速度").toDouble();
+            axis.profileJerk = values.value(u8"加加速度").toDouble();
+            axis.vel = axis.profileVel;
+            axis.acc = axis.profileAcc;
+            axis.jerk = axis.profileJerk;
+            new_axes.append(axis);
+        }
+        else if(type == u8"输入点")
+            new_inputs.append(name.toStdWString());
+        else if(type == u8"输出点")
+            new_outputs.append(name.toStdWString());
+        else if(type == u8"寻找原点")
+            home_vels[name] = values.value(u8"速度").toDouble();
+    }
+    for (int i = 0; i < new_axes.size(); i++)
+        new_axes[i].homeVel = home_vels.value(QString::fromStdWString(new_axes[i].name));
+
+    locker.lock();
+    axes = new_axes;
+    inputNames = new_inputs;
+    outputNames = new_outputs;
+    inputs.fill(0, inputNames.size());
+    outputs.fill(0, outputNames.size());
+    ioLinks.clear();
+    pendingInputs.clear();
+    threads.clear();
+    curves.clear();
+    locker.unlock();
+    qInfo("XtSimulator load profile %s, %d axes %d inputs %d outputs", file_path.toStdString().c_str(),
+          new_axes.size(), new_inputs.size(), new_outputs.size());
+
+    QString links_path = QString::fromLocal8Bit(qgetenv("XT_SIM_IO_LINKS"));
+    if(links_path.isEmpty())
+        links_path = QFileInfo(file_path).dir().filePath("xt_simulation_links.csv");
+    if(QFile::exists(links_path))
+        loadIoLinks(links_path);
+    return true;
+}
+
+bool XtSimulator::loadIoLinks(const QString &file_path)
+{
+    QFile file(file_path);
+    if(!file.open(QIODevice::ReadOnly))
+    {
+        qWarning("XtSimulator open io links %s fail", file_path.toStdString().c_str());
+        return false;
+    }
+    QTextStream stream(&file);
+    stream.setCodec("UTF-8");
+    //每行为 输出点,输入点,延时ms,反相
+    while (!stream.atEnd()) {
+        QStringList fields = stream.readLine().split(',');
+        if(fields.size() < 2)
+            continue;
+        int output_id = findOutput(fields[0].trimmed());
+        int input_id = findInput(fields[1].trimmed());
+        if(output_id < 0 || input_id < 0)
+        {
+            qWarning("XtSimulator io link %s -> %s not found", fields[0].toStdString().c_str(), fields[1].toStdString().c_str());
+            continue;
+        }
+        double delay = fields.size() > 2 ? fields[2].toDouble() : 0;
+        bool invert = fields.size() > 3 && fields[3].trimmed().toInt() != 0;
+        linkOutputToInput(output_id, input_id, delay, invert);
+    }
+    return true;
+}
+
+void XtSimulator::linkOutputToInput(int output_id, int input_id, double delay_ms, bool invert)
+{
+    QMutexLocker tmpLocker(&locker);
+    IoLink link;
+    link.input_id = input_id;
+    link.delay = delay_ms;
+    link.invert = invert;
+    ioLinks[output_id].append(link);
+}
+
+void XtSimulator::setTimeScale(double scale)
+{
+    if(scale <= 0)
+        return;
+    QMutexLocker tmpLocker(&locker);
+    baseMs = now();
+    clock.restart();
+    this->scale = scale;
+}
+
+void XtSimulator::setSettleOscillation(double amplitude, double frequency, double decay_ms)
+{
+    QMutexLocker tmpLocker(&locker);
+    settleAmplitude = qMax(0.0, amplitude);
+    settleFrequency = qMax(0.0, frequency);
+    settleDecay = qMax(0.001, decay_ms);
+}
+
+double XtSimulator::timeScale()
+{
+    QMutexLocker tmpLocker(&locker);
+    return scale;
+}
+
+double XtSimulator::simulatedMs()
+{
+    QMutexLocker tmpLocker(&locker);
+    return now();
+}
+
+int XtSimulator::append(int thread, const Instruction &instruction)
+{
+    QMutexLocker tmpLocker(&locker);
+    threads[thread].program.append(instruction);
+    update();
+    return 1;
+}
+
+int XtSimulator::waitAllFinish(int thread)
+{
+    QMutexLocker tmpLocker(&locker);
+    while (true) {
+        update();
+        if(threads.value(thread).program.isEmpty())
+            return 1;
+        threadFinished.wait(&locker, TICK_INTERVAL);
+    }
+}
+
+int XtSimulator::remainCount(int thread, int &remain_count, int &finish)
+{
+    QMutexLocker tmpLocker(&locker);
+    update();
+    const ProgramThread &current = threads[thread];
+    remain_count = current.program.size() - current.pc;
+    finish = remain_count == 0 ? 1 : 0;
+    return 1;
+}
+
+int XtSimulator::clearThread(int thread)
+{
+    QMutexLocker tmpLocker(&locker);
+    ProgramThread &current = threads[thread];
+    current.program.clear();
+    current.pc = 0;
+    current.waiting = false;
+    threadFinished.wakeAll();
+    return 1;
+}
+
+double XtSimulator::readRegister(int thread, int reg_id)
+{
+    QMutexLocker tmpLocker(&locker);
+    update();
+    return threads[thread].registers.value(reg_id);
+}
+
+int XtSimulator::axisCount()
+{
+    QMutexLocker tmpLocker(&locker);
+    return axes.size();
+}
+
+int XtSimulator::findAxis(const QString &name)
+{
+    QMutexLocker tmpLocker(&locker);
+    for (int i = 0; i < axes.size(); i++)
+        if(QString::fromStdWString(axes[i].name) == name)
+            return i;
+    return -1;
+}
+
+const wchar_t *XtSimulator::axisName(int axis_id)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(!validAxis(axis_id))
+        return L"";
+    return axes[axis_id].name.c_str();
+}
+
+double XtSimulator::axisParameter(int axis_id, int index)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(!validAxis(axis_id))
+        return 0;
+    const Axis &axis = axes[axis_id];
+    switch (index) {
+    case AXIS_MAX_VEL: return axis.profileVel;
+    case AXIS_MAX_ACC: return axis.profileAcc;
+    case AXIS_MAX_JERK: return axis.profileJerk;
+    case AXIS_MAX_POS: return axis.maxPos;
+    case AXIS_MIN_POS: return axis.minPos;
+    }
+    return 0;
+}
+
+int XtSimulator::axisState(int axis_id, double &pos, double &vel, double &acc, bool &running)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(!validAxis(axis_id))
+        return 0;
+    update();
+    const Axis &axis = axes[axis_id];
+    pos = axis.pos;
+    vel = axis.curVel;
+    acc = axis.curAcc;
+    running = axis.running;
+    //停止后的残余振荡
+    if(!axis.running && axis.settleStart >= 0 && settleAmplitude > 0)
+    {
+        double t = now() - axis.settleStart;
+        pos += settleAmplitude * qExp(-t / settleDecay) * qCos(2 * M_PI * settleFrequency * t / 1000);
+    }
+    return 1;
+}
+
+int XtSimulator::inputCount()
+{
+    QMutexLocker tmpLocker(&locker);
+    return inputNames.size();
+}
+
+int XtSimulator::outputCount()
+{
+    QMutexLocker tmpLocker(&locker);
+    return outputNames.size();
+}
+
+int XtSimulator::findInput(const QString &name)
+{
+    QMutexLocker tmpLocker(&locker);
+    for (int i = 0; i < inputNames.size(); i++)
+        if(QString::fromStdWString(inputNames[i]) == name)
+            return i;
+    return -1;
+}
+
+int XtSimulator::findOutput(const QString &name)
+{
+    QMutexLocker tmpLocker(&locker);
+    for (int i = 0; i < outputNames.size(); i++)
+        if(QString::fromStdWString(outputNames[i]) == name)
+            return i;
+    return -1;
+}
+
+const wchar_t *XtSimulator::inputName(int io_id)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(io_id < 0 || io_id >= inputNames.size())
+        return L"";
+    return inputNames[io_id].c_str();
+}
+
+const wchar_t *XtSimulator::outputName(int io_id)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(io_id < 0 || io_id >= outputNames.size())
+        return L"";
+    return outputNames[io_id].c_str();
+}
+
+int XtSimulator::setOutput(int io_id, int value)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(io_id < 0 || io_id >= outputs.size())
+        return 0;
+    writeOutput(io_id, value, now());
+    return 1;
+}
+
+int XtSimulator::setInput(int io_id, int value)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(io_id < 0 || io_id >= inputs.size())
+        return 0;
+    inputs[io_id] = value;
+    return 1;
+}
+
+int XtSimulator::inputState(int io_id, int &state)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(io_id < 0 || io_id >= inputs.size())
+        return 0;
+    update();
+    state = inputs[io_id];
+    return 1;
+}
+
+int XtSimulator::outputState(int io_id, int &state)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(io_id < 0 || io_id >= outputs.size())
+        return 0;
+    state = outputs[io_id];
+    return 1;
+}
+
+int XtSimulator::setAxisTrig(int axis_id, bool reverse, double trig_pos, int io_id, int value)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(!validAxis(axis_id) || io_id < 0 || io_id >= outputs.size())
+        return 0;
+    update();
+    AxisTrig &trig = axes[axis_id].trig;
+    trig.armed = true;
+    trig.reverse = reverse;
+    trig.pos = trig_pos;
+    trig.io_id = io_id;
+    trig.value = value;
+    return 1;
+}
+
+int XtSimulator::clearAxisTrig(int axis_id)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(!validAxis(axis_id))
+        return 0;
+    axes[axis_id].trig.armed = false;
+    return 1;
+}
+
+int XtSimulator::encoderValue(int encoder_id, long long &value)
+{
+    QMutexLocker tmpLocker(&locker);
+    value = encoders.value(encoder_id);
+    return 1;
+}
+
+int XtSimulator::setEncoderValue(int encoder_id, long long value)
+{
+    QMutexLocker tmpLocker(&locker);
+    encoders[encoder_id] = value;
+    return 1;
+}
+
+int XtSimulator::setCurveParam(int curve_id, int dem, const int *axis, const double *max_acc)
+{
+    QMutexLocker tmpLocker(&locker);
+    Curve &curve = curves[curve_id];
+    if(curve.running)
+        return 0;
+    curve = Curve();
+    for (int i = 0; i < dem; i++) {
+        if(!validAxis(axis[i]))
+            return 0;
+        curve.axis.append(axis[i]);
+        //插补加速度取各轴中最小的
+        if(i == 0 || max_acc[i] < curve.maxAcc)
+            curve.maxAcc = max_acc[i];
+    }
+    return 1;
+}
+
+int XtSimulator::appendCurvePoint(int curve_id, int dem, const int *axis, const double *pos, double max_vel, double end_vel, int &point_index)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(!curves.contains(curve_id))
+        return 0;
+    Curve &curve = curves[curve_id];
+    if(curve.running || dem != curve.axis.size())
+        return 0;
+    QVector<double> point;
+    for (int i = 0; i < dem; i++) {
+        if(axis[i] != curve.axis[i])
+            return 0;
+        point.append(pos[i]);
+    }
+    curve.points.append(point);
+    curve.maxVel.append(max_vel);
+    curve.endVel.append(end_vel);
+    point_index = curve.points.size() - 1;
+    return 1;
+}
+
+double XtSimulator::curveLength(int curve_id, int point_index)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(!curves.contains(curve_id))
+        return 0;
+    const Curve &curve = curves[curve_id];
+    double length = 0;
+    for (int i = 1; i <= point_index && i < curve.points.size(); i++) {
+        double square = 0;
+        for (int j = 0; j < curve.axis.size(); j++)
+            square += qPow(curve.points[i][j] - curve.points[i - 1][j], 2);
+        length += qSqrt(square);
+    }
+    return length;
+}
+
+int XtSimulator::setCurveTrig(int curve_id, int mode, double distance, int io_id, int value)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(!curves.contains(curve_id) || io_id < 0 || io_id >= outputs.size())
+        return 0;
+    Curve &curve = curves[curve_id];
+    if(curve.points.size() < 2)
+        return 0;
+    //触发挂在最后添加的线段上, mode 1 从线段终点往回计距离
+    CurveTrig trig;
+    trig.segment = curve.points.size() - 2;
+    trig.distance = distance;
+    if(mode == 1)
+    {
+        double square = 0;
+        for (int j = 0; j < curve.axis.size(); j++)
+            square += qPow(curve.points[trig.segment + 1][j] - curve.points[trig.segment][j], 2);
+        trig.distance += qSqrt(square);
+    }
+    trig.io_id = io_id;
+    trig.value = value;
+    trig.fired = false;
+    curve.trigs.append(trig);
+    return 1;
+}
+
+int XtSimulator::curveFinished(int curve_id)
+{
+    QMutexLocker tmpLocker(&locker);
+    update();
+    return curves.value(curve_id).finished ? 1 : 0;
+}
+
+int XtSimulator::clearCurve(int curve_id)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(!curves.contains(curve_id))
+        return 1;
+    update();
+    foreach (int axis_id, curves[curve_id].axis) {
+        Axis &axis = axes[axis_id];
+        if(axis.curveId != curve_id)
+            continue;
+        axis.curveId = -1;
+        axis.running = false;
+        axis.curVel = 0;
+        axis.curAcc = 0;
+    }
+    curves.remove(curve_id);
+    return 1;
+}
+
+void XtSimulator::run()
+{
+    while (isRun) {
+        locker.lock();
+        update();
+        locker.unlock();
+        msleep(TICK_INTERVAL);
+    }
+}
+
+XtSimulator::MotionProfile XtSimulator::planPointMove(double start_pos, double end_pos, double vel, double acc, double jerk)
+{
+    MotionProfile profile;
+    profile.startPos = start_pos;
+    profile.endPos = end_pos;
+    profile.direction = end_pos >= start_pos ? 1 : -1;
+    double distance = qAbs(end_pos - start_pos);
+    if(distance < 1e-9 || vel <= 0 || acc <= 0)
+        return profile;
+    if(jerk <= 0)
+    {
+        profile.segments = planLineSegment(distance, 0, 0, vel, acc).segments;
+        return profile;
+    }
+
+    //S曲线: 加速段由加加速、匀加速、减加速组成, 减速段与之对称
+    auto accelerate = [acc, jerk](double v, double &tj, double &ta, double &ap)
+    {
+        if(v * jerk >= acc * acc)
+        {
+            tj = acc / jerk;
+            ta = v / acc + tj;
+            ap = acc;
+        }
+        else
+        {
+            tj = qSqrt(v / jerk);
+            ta = 2 * tj;
+            ap = jerk * tj;
+        }
+    };
+    double v = vel, tj, ta, ap;
+    accelerate(v, tj, ta, ap);
+    if(v * ta > distance)
+    {
+        //行程不足以达到最大速度, 二分查找可达到的峰值速度
+        double low = 0, high = vel;
+        for (int i = 0; i < 60; i++) {
+            v = (low + high) / 2;
+            accelerate(v, tj, ta, ap);
+            if(v * ta > distance)
+                high = v;
+            else
+                low = v;
+        }
+        v = low;
+        if(v <= 1e-12)
+            return profile;
+        accelerate(v, tj, ta, ap);
+    }
+    double tv = (distance - v * ta) / v;
+    double tc = ta - 2 * tj;
+    MotionSegment segments[7] = {{tj, 0, jerk}, {tc, ap, 0}, {tj, ap, -jerk}, {tv, 0, 0},
+                                 {tj, 0, -jerk}, {tc, -ap, 0}, {tj, -ap, jerk}};
+    for (int i = 0; i < 7; i++)
+        if(segments[i].duration > 1e-12)
+            profile.segments.append(segments[i]);
+    return profile;
+}
+
+XtSimulator::MotionProfile XtSimulator::planLineSegment(double length, double start_vel, double end_vel, double max_vel, double acc)
+{
+    MotionProfile profile;
+    profile.endPos = length;
+    if(length < 1e-9 || max_vel <= 0 || acc <= 0)
+        return profile;
+    start_vel = qMin(start_vel, max_vel);
+    end_vel = qMin(qMin(end_vel, max_vel), qSqrt(start_vel * start_vel + 2 * acc * length));
+    end_vel = qMax(end_vel, qSqrt(qMax(0.0, start_vel * start_vel - 2 * acc * length)));
+    profile.startVel = start_vel;
+    profile.endVel = end_vel;
+
+    double peak = qSqrt((2 * acc * length + start_vel * start_vel + end_vel * end_vel) / 2);
+    peak = qMax(qMin(peak, max_vel), qMax(start_vel, end_vel));
+    double ta = (peak - start_vel) / acc;
+    double td = (peak - end_vel) / acc;
+    double cruise = length - (peak * peak - start_vel * start_vel) / (2 * acc) - (peak * peak - end_vel * end_vel) / (2 * acc);
+    double tc = peak > 0 ? qMax(0.0, cruise) / peak : 0;
+    MotionSegment segments[3] = {{ta, acc, 0}, {tc, 0, 0}, {td, -acc, 0}};
+    for (int i = 0; i < 3; i++)
+        if(segments[i].duration > 1e-12)
+            profile.segments.append(segments[i]);
+    return profile;
+}
+
+XtSimulator::MotionProfile XtSimulator::planStop(double pos, double vel, double acc)
+{
+    MotionProfile profile;
+    profile.startPos = pos;
+    profile.endPos = pos;
+    double speed = qAbs(vel);
+    if(speed < 1e-9 || acc <= 0)
+        return profile;
+    profile.direction = vel > 0 ? 1 : -1;
+    profile.startVel = speed;
+    profile.endPos = pos + profile.direction * speed * speed / (2 * acc);
+    MotionSegment segment = {speed / acc, -acc, 0};
+    profile.segments.append(segment);
+    return profile;
+}
+
+bool XtSimulator::evaluate(const MotionProfile &profile, double time, double &pos, double &vel, double &acc)
+{
+    double t = qMax(0.0, (time - profile.startTime) / 1000);
+    double p = 0, v = profile.startVel, a = 0;
+    foreach (MotionSegment segment, profile.segments) {
+        double dt = qMin(t, segment.duration);
+        p += v * dt + segment.startAcc * dt * dt / 2 + segment.jerk * dt * dt * dt / 6;
+        v += segment.startAcc * dt + segment.jerk * dt * dt / 2;
+        a = segment.startAcc + segment.jerk * dt;
+        t -= dt;
+        if(dt < segment.duration)
+        {
+            pos = profile.startPos + profile.direction * p;
+            vel = profile.direction * v;
+            acc = profile.direction * a;
+            return false;
+        }
+    }
+    pos = profile.endPos;
+    vel = profile.direction * profile.endVel;
+    acc = 0;
+    return true;
+}
+
+double XtSimulator::duration(const MotionProfile &profile)
+{
+    double result = 0;
+    foreach (MotionSegment segment, profile.segments)
+        result += segment.duration;
+    return result;
+}
+
+double XtSimulator::now()
+{
+    return baseMs + clock.nsecsElapsed() / 1e6 * scale;
+}
+
+void XtSimulator::update()
+{
+    double time = now();
+    for (int i = pendingInputs.size() - 1; i >= 0; i--) {
+        if(pendingInputs[i].time > time)
+            continue;
+        inputs[pendingInputs[i].input_id] = pendingInputs[i].value;
+        pendingInputs.removeAt(i);
+    }
+    foreach (int curve_id, curves.keys())
+        updateCurve(curve_id, time);
+    for (int i = 0; i < axes.size(); i++)
+        updateAxis(i, time);
+    bool finished = false;
+    for (auto it = threads.begin(); it != threads.end(); ++it)
+        finished |= step(it.value(), time);
+    if(finished)
+        threadFinished.wakeAll();
+}
+
+void XtSimulator::updateAxis(int axis_id, double time)
+{
+    Axis &axis = axes[axis_id];
+    if(!axis.running || axis.curveId >= 0)
+        return;
+    double pos;
+    bool finished = evaluate(axis.profile, time, pos, axis.curVel, axis.curAcc);
+    moveAxisTo(axis_id, pos, time);
+    if(finished)
+    {
+        axis.running = false;
+        axis.curVel = 0;
+        axis.curAcc = 0;
+        axis.settleStart = time;
+    }
+}
+
+void XtSimulator::updateCurve(int curve_id, double time)
+{
+    Curve &curve = curves[curve_id];
+    if(!curve.running)
+        return;
+    for (int k = 0; k < curve.profiles.size(); k++) {
+        double s, v, a;
+        bool done = evaluate(curve.profiles[k], time, s, v, a);
+        for (int i = 0; i < curve.trigs.size(); i++) {
+            CurveTrig &trig = curve.trigs[i];
+            if(trig.segment == k && !trig.fired && s >= trig.distance)
+            {
+                trig.fired = true;
+                writeOutput(trig.io_id, trig.value, time);
+            }
+        }
+        if(done)
+            continue;
+        double length = curve.profiles[k].endPos;
+        for (int j = 0; j < curve.axis.size(); j++) {
+            double delta = curve.points[k + 1][j] - curve.points[k][j];
+            moveAxisTo(curve.axis[j], curve.points[k][j] + delta * s / length, time);
+            axes[curve.axis[j]].curVel = v * delta / length;
+            axes[curve.axis[j]].curAcc = a * delta / length;
+        }
+        return;
+    }
+    for (int j = 0; j < curve.axis.size(); j++) {
+        Axis &axis = axes[curve.axis[j]];
+        moveAxisTo(curve.axis[j], curve.points.last()[j], time);
+        axis.curveId = -1;
+        axis.running = false;
+        axis.curVel = 0;
+        axis.curAcc = 0;
+        axis.settleStart = time;
+    }
+    curve.running = false;
+    curve.finished = true;
+}
+
+void XtSimulator::moveAxisTo(int axis_id, double pos, double time)
+{
+    Axis &axis = axes[axis_id];
+    AxisTrig &trig = axis.trig;
+    if(trig.armed)
+    {
+        bool crossed = trig.reverse ? (axis.pos > trig.pos && pos <= trig.pos)
+                                    : (axis.pos < trig.pos && pos >= trig.pos);
+        if(crossed)
+        {
+            trig.armed = false;
+            writeOutput(trig.io_id, trig.value, time);
+        }
+    }
+    axis.pos = pos;
+}
+
+void XtSimulator::startAxisMove(int axis_id, double target, double time)
+{
+    if(!validAxis(axis_id))
+        return;
+    updateAxis(axis_id, time);
+    Axis &axis = axes[axis_id];
+    if(axis.curveId >= 0)
+    {
+        qWarning("XtSimulator axis %d is running curve %d", axis_id, axis.curveId);
+        return;
+    }
+    //运动中重新下发目标时从当前位置静止重新规划
+    axis.profile = planPointMove(axis.pos, target, axis.vel, axis.acc, axis.jerk);
+    axis.profile.startTime = time;
+    axis.running = true;
+}
+
+void XtSimulator::stopAxis(int axis_id, double time, bool smooth)
+{
+    if(!validAxis(axis_id))
+        return;
+    updateAxis(axis_id, time);
+    Axis &axis = axes[axis_id];
+    if(!axis.running || axis.curveId >= 0)
+        return;
+    if(smooth)
+    {
+        axis.profile = planStop(axis.pos, axis.curVel, axis.acc);
+        axis.profile.startTime = time;
+    }
+    else
+    {
+        axis.running = false;
+        axis.curVel = 0;
+        axis.curAcc = 0;
+    }
+}
+
+void XtSimulator::startCurve(int curve_id, double time)
+{
+    Curve &curve = curves[curve_id];
+    curve.profiles.clear();
+    curve.finished = false;
+    if(curve.points.size() < 2)
+    {
+        curve.finished = true;
+        return;
+    }
+    double vel = 0;
+    double start_time = time;
+    for (int i = 1; i < curve.points.size(); i++) {
+        double square = 0;
+        for (int j = 0; j < curve.axis.size(); j++)
+            square += qPow(curve.points[i][j] - curve.points[i - 1][j], 2);
+        MotionProfile profile = planLineSegment(qSqrt(square), vel, curve.endVel[i], curve.maxVel[i], curve.maxAcc);
+        profile.startTime = start_time;
+        start_time += duration(profile) * 1000;
+        vel = profile.endVel;
+        curve.profiles.append(profile);
+    }
+    for (int i = 0; i < curve.trigs.size(); i++)
+        curve.trigs[i].fired = false;
+    foreach (int axis_id, curve.axis) {
+        updateAxis(axis_id, time);
+        axes[axis_id].curveId = curve_id;
+        axes[axis_id].running = true;
+    }
+    curve.running = true;
+    updateCurve(curve_id, time);
+}
+
+void XtSimulator::writeOutput(int io_id, int value, double time)
+{
+    if(io_id < 0 || io_id >= outputs.size())
+        return;
+    outputs[io_id] = value;
+    foreach (IoLink link, ioLinks.value(io_id)) {
+        int input_value = link.invert ? (value ? 0 : 1) : value;
+        if(link.delay <= 0)
+        {
+            inputs[link.input_id] = input_value;
+            continue;
+        }
+        PendingInput pending;
+        pending.input_id = link.input_id;
+        pending.value = input_value;
+        pending.time = time + link.delay;
+        pendingInputs.append(pending);
+    }
+}
+
+bool XtSimulator::step(ProgramThread &thread, double time)
+{
+    if(thread.program.isEmpty())
+        return false;
+    while (thread.pc < thread.program.size()) {
+        const Instruction ins = thread.program[thread.pc];
+        bool blocked = false;
+        int skip = 0;
+        switch (ins.type) {
+        case INS_SGO:
+            startAxisMove(ins.id, ins.value, time);
+            break;
+        case INS_SGO_R:
+            startAxisMove(ins.id, thread.registers.value(ins.reg), time);
+            break;
+        case INS_SGO_INCREASE_LIMIT:
+            if(validAxis(ins.id))
+            {
+                updateAxis(ins.id, time);
+                const Axis &axis = axes[ins.id];
+                double target = (axis.running ? axis.profile.endPos : axis.pos) + ins.value;
+                target = ins.value > 0 ? qMin(target, ins.limit) : qMax(target, ins.limit);
+                startAxisMove(ins.id, target, time);
+            }
+            break;
+        case INS_SET_VEL:
+            if(validAxis(ins.id)) axes[ins.id].vel = ins.value;
+            break;
+        case INS_SET_ACC:
+            if(validAxis(ins.id)) axes[ins.id].acc = ins.value;
+            break;
+        case INS_SET_JERK:
+            if(validAxis(ins.id)) axes[ins.id].jerk = ins.value;
+            break;
+        case INS_SET_ZERO:
+            if(validAxis(ins.id))
+            {
+                stopAxis(ins.id, time, false);
+                axes[ins.id].pos = ins.value;
+            }
+            break;
+        case INS_STOP_S:
+            stopAxis(ins.id, time, true);
+            break;
+        case INS_STOP_T:
+            stopAxis(ins.id, time, false);
+            break;
+        case INS_SEEK_ORIGIN:
+            //回原点按原点速度走到零位
+            if(!validAxis(ins.id))
+                break;
+            if(!thread.waiting)
+            {
+                Axis &axis = axes[ins.id];
+                double vel = axis.vel;
+                if(axis.homeVel > 0)
+                    axis.vel = axis.homeVel;
+                startAxisMove(ins.id, 0, time);
+                axis.vel = vel;
+                thread.waiting = true;
+            }
+            blocked = axes[ins.id].running;
+            break;
+        case INS_TILL_STOP:
+            blocked = validAxis(ins.id) && axes[ins.id].running;
+            break;
+        case INS_TILL_TIME:
+            if(!thread.waiting)
+            {
+                thread.waiting = true;
+                thread.waitUntil = time + ins.value;
+            }
+            blocked = time < thread.waitUntil;
+            break;
+        case INS_TILL_IO:
+            blocked = ins.id >= 0 && ins.id < inputs.size() && inputs[ins.id] != 1;
+            break;
+        case INS_TILL_IO_NEG:
+            blocked = ins.id >= 0 && ins.id < inputs.size() && inputs[ins.id] == 1;
+            break;
+        case INS_SET_OUTPUT:
+            writeOutput(ins.id, int(ins.value), time);
+            break;
+        case INS_GET_INPUT:
+            thread.registers[ins.reg] = ins.id >= 0 && ins.id < inputs.size() ? inputs[ins.id] : 0;
+            break;
+        case INS_GET_OUTPUT_POS:
+            thread.registers[ins.reg] = validAxis(ins.id) ? axes[ins.id].pos : 0;
+            break;
+        case INS_ADD_R_C:
+            thread.registers[ins.reg] = thread.registers.value(ins.id) + ins.value;
+            break;
+        case INS_CONDITION_NEG_JMP:
+            if(thread.registers.value(ins.reg) != ins.value)
+                skip = int(ins.limit);
+            break;
+        case INS_EXEC_CURVE:
+            if(!curves.contains(ins.id))
+                break;
+            if(!thread.waiting)
+            {
+                startCurve(ins.id, time);
+                thread.waiting = true;
+            }
+            blocked = curves[ins.id].running;
+            break;
+        }
+        if(blocked)
+            return false;
+        thread.waiting = false;
+        thread.pc += 1 + skip;
+    }
+    thread.program.clear();
+    thread.pc = 0;
+    return true;
+}
+
+bool XtSimulator::validAxis(int axis_id)
+{
+    return axis_id >= 0 && axis_id < axes.size();
+}
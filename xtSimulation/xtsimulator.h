@@ -0,0 +1,252 @@
+#ifndef XTSIMULATOR_H
+#define XTSIMULATOR_H
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+#include <QVector>
+#include <QMap>
+#include <QString>
+#include <string>
+
+/*
+ * Kinematic stand-in for the XT motion controller.
+ * Axes follow trapezoidal profiles, or S-curve profiles when a jerk is set,
+ * on a simulated clock that runs timeScale times faster than the wall clock.
+ * Every controller thread executes its own instruction buffer, curves move
+ * their axes along the appended line segments, and outputs can be linked to
+ * inputs so that cylinders and vacuums see their sensors change.
+ * An optional decaying oscillation is added to the position read back after
+ * a move ends, so that settle detection can be exercised.
+ */
+class XtSimulator:public QThread
+{
+    Q_OBJECT
+
+public:
+    static XtSimulator *instance();
+    ~XtSimulator() override;
+
+    void startThd();
+    void stopThd();
+
+    bool loadProfile(const QString &file_path);
+    bool loadIoLinks(const QString &file_path);
+    void linkOutputToInput(int output_id, int input_id, double delay_ms, bool invert = false);
+    void setTimeScale(double scale);
+    double timeScale();
+    double simulatedMs();
+    void setSettleOscillation(double amplitude, double frequency, double decay_ms);
+
+    enum InstructionType
+    {
+        INS_SGO,
+        INS_SGO_R,
+        INS_SGO_INCREASE_LIMIT,
+        INS_SET_VEL,
+        INS_SET_ACC,
+        INS_SET_JERK,
+        INS_SET_ZERO,
+        INS_STOP_S,
+        INS_STOP_T,
+        INS_SEEK_ORIGIN,
+        INS_TILL_STOP,
+        INS_TILL_TIME,
+        INS_TILL_IO,
+        INS_TILL_IO_NEG,
+        INS_SET_OUTPUT,
+        INS_GET_INPUT,
+        INS_GET_OUTPUT_POS,
+        INS_ADD_R_C,
+        INS_CONDITION_NEG_JMP,
+        INS_EXEC_CURVE
+    };
+
+    struct Instruction
+    {
+        InstructionType type;
+        int id;
+        int reg;
+        double value;
+        double limit;
+    };
+
+    int append(int thread, const Instruction &instruction);
+    int waitAllFinish(int thread);
+    int remainCount(int thread, int &remain_count, int &finish);
+    int clearThread(int thread);
+    double readRegister(int thread, int reg_id);
+
+    int axisCount();
+    int findAxis(const QString &name);
+    const wchar_t *axisName(int axis_id);
+    double axisParameter(int axis_id, int index);
+    int axisState(int axis_id, double &pos, double &vel, double &acc, bool &running);
+
+    int inputCount();
+    int outputCount();
+    int findInput(const QString &name);
+    int findOutput(const QString &name);
+    const wchar_t *inputName(int io_id);
+    const wchar_t *outputName(int io_id);
+    int setOutput(int io_id, int value);
+    int setInput(int io_id, int value);
+    int inputState(int io_id, int &state);
+    int outputState(int io_id, int &state);
+    int setAxisTrig(int axis_id, bool reverse, double trig_pos, int io_id, int value);
+    int clearAxisTrig(int axis_id);
+
+    int encoderValue(int encoder_id, long long &value);
+    int setEncoderValue(int encoder_id, long long value);
+
+    int setCurveParam(int curve_id, int dem, const int *axis, const double *max_acc);
+    int appendCurvePoint(int curve_id, int dem, const int *axis, const double *pos, double max_vel, double end_vel, int &point_index);
+    double curveLength(int curve_id, int point_index);
+    int setCurveTrig(int curve_id, int mode, double distance, int io_id, int value);
+    int curveFinished(int curve_id);
+    int clearCurve(int curve_id);
+
+    enum AxisParameter
+    {
+        AXIS_MAX_VEL,
+        AXIS_MAX_ACC,
+        AXIS_MAX_JERK,
+        AXIS_MAX_POS,
+        AXIS_MIN_POS
+    };
+
+protected:
+    void run() override;
+
+private:
+    explicit XtSimulator();
+
+    //一段运动: 初始加速度和加加速度在整段内不变
+    struct MotionSegment
+    {
+        double duration;
+        double startAcc;
+        double jerk;
+    };
+    struct MotionProfile
+    {
+        double startTime = 0;
+        double startPos = 0;
+        double endPos = 0;
+        double startVel = 0;
+        double endVel = 0;
+        double direction = 1;
+        QVector<MotionSegment> segments;
+    };
+    struct AxisTrig
+    {
+        bool armed = false;
+        bool reverse = false;
+        double pos = 0;
+        int io_id = -1;
+        int value = 0;
+    };
+    struct Axis
+    {
+        std::wstring name;
+        double maxPos = 0;
+        double minPos = 0;
+        double profileVel = 0;
+        double profileAcc = 0;
+        double profileJerk = 0;
+        double homeVel = 0;
+        double vel = 0;
+        double acc = 0;
+        double jerk = 0;
+        double pos = 0;
+        double curVel = 0;
+        double curAcc = 0;
+        bool running = false;
+        int curveId = -1;
+        double settleStart = -1;
+        MotionProfile profile;
+        AxisTrig trig;
+    };
+    struct ProgramThread
+    {
+        QVector<Instruction> program;
+        int pc = 0;
+        bool waiting = false;
+        double waitUntil = 0;
+        QMap<int, double> registers;
+    };
+    struct CurveTrig
+    {
+        int segment;
+        double distance;
+        int io_id;
+        int value;
+        bool fired;
+    };
+    struct Curve
+    {
+        QVector<int> axis;
+        double maxAcc = 0;
+        QVector<QVector<double>> points;
+        QVector<double> maxVel;
+        QVector<double> endVel;
+        QVector<CurveTrig> trigs;
+        QVector<MotionProfile> profiles;
+        bool running = false;
+        bool finished = false;
+    };
+    struct IoLink
+    {
+        int input_id;
+        double delay;
+        bool invert;
+    };
+    struct PendingInput
+    {
+        int input_id;
+        int value;
+        double time;
+    };
+
+    static MotionProfile planPointMove(double start_pos, double end_pos, double vel, double acc, double jerk);
+    static MotionProfile planLineSegment(double length, double start_vel, double end_vel, double max_vel, double acc);
+    static MotionProfile planStop(double pos, double vel, double acc);
+    static bool evaluate(const MotionProfile &profile, double time, double &pos, double &vel, double &acc);
+    static double duration(const MotionProfile &profile);
+
+    double now();
+    void update();
+    void updateAxis(int axis_id, double time);
+    void updateCurve(int curve_id, double time);
+    void moveAxisTo(int axis_id, double pos, double time);
+    void startAxisMove(int axis_id, double target, double time);
+    void stopAxis(int axis_id, double time, bool smooth);
+    void startCurve(int curve_id, double time);
+    void writeOutput(int io_id, int value, double time);
+    bool step(ProgramThread &thread, double time);
+    bool validAxis(int axis_id);
+
+    const ulong TICK_INTERVAL = 1;
+    bool isRun = false;
+    double scale = 1;
+    double baseMs = 0;
+    double settleAmplitude = 0;
+    double settleFrequency = 50;
+    double settleDecay = 20;
+    QElapsedTimer clock;
+    QVector<Axis> axes;
+    QVector<std::wstring> inputNames;
+    QVector<std::wstring> outputNames;
+    QVector<int> inputs;
+    QVector<int> outputs;
+    QMap<int, QVector<IoLink>> ioLinks;
+    QVector<PendingInput> pendingInputs;
+    QMap<int, ProgramThread> threads;
+    QMap<int, Curve> curves;
+    QMap<int, long long> encoders;
+    QMutex locker;
+    QWaitCondition threadFinished;
+};
+
+#endif // XTSIMULATOR_H
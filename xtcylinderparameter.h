@@ -18,6 +18,7 @@ public:
     Q_PROPERTY(int finishOneDelay READ finishOneDelay WRITE setFinishOneDelay NOTIFY finishOneDelayChanged)
     Q_PROPERTY(int finishZeroDelay READ finishZeroDelay WRITE setFinishZeroDelay NOTIFY finishZeroDelayChanged)
     Q_PROPERTY(int outTime READ outTime WRITE setOutTime NOTIFY outTimeChanged)
+    Q_PROPERTY(int debounceTime READ debounceTime WRITE setDebounceTime NOTIFY debounceTimeChanged)
     QString cylinderName() const
     {
         return m_cylinderName;
@@ -58,6 +59,11 @@ public:
         return m_outTime;
     }
 
+    int debounceTime() const
+    {
+        return m_debounceTime;
+    }
+
 public slots:
     void setCylinderName(QString cylinderName)
     {
@@ -131,6 +137,15 @@ public slots:
         emit outTimeChanged(m_outTime);
     }
 
+    void setDebounceTime(int debounceTime)
+    {
+        if (m_debounceTime == debounceTime)
+            return;
+
+        m_debounceTime = debounceTime;
+        emit debounceTimeChanged(m_debounceTime);
+    }
+
 signals:
     void cylinderNameChanged(QString cylinderName);
 
@@ -148,6 +163,8 @@ signals:
 
     void outTimeChanged(int outTime);
 
+    void debounceTimeChanged(int debounceTime);
+
 private:
     QString m_cylinderName = "Cylinder";
     QString m_oneOutName = "";
@@ -157,6 +174,7 @@ private:
     int m_finishOneDelay = 100;
     int m_finishZeroDelay = 100;
     int m_outTime = 3000;
+    int m_debounceTime = 0;
 };
 
 #endif // CYLINDERPARAMETER_H
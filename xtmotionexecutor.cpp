@@ -0,0 +1,347 @@
+#include "xtmotionexecutor.h"
+#include "XtGeneralOutput.h"
+#include "xtmotor.h"
+#include "xtmotionmonitor.h"
+#include "XT_MotionControler_Client_Lib.h"
+#include <QtConcurrent/QtConcurrent>
+#include <cmath>
+
+XtMotionSequence &XtMotionSequence::move(XtMotor *motor, double pos)
+{
+    Step step = {Move,motor,nullptr,pos};
+    steps.append(step);
+    return *this;
+}
+
+XtMotionSequence &XtMotionSequence::waitStop(XtMotor *motor)
+{
+    Step step = {WaitStop,motor,nullptr,0};
+    steps.append(step);
+    return *this;
+}
+
+XtMotionSequence &XtMotionSequence::moveAndWait(XtMotor *motor, double pos)
+{
+    return move(motor,pos).waitStop(motor);
+}
+
+XtMotionSequence &XtMotionSequence::setOutput(XtGeneralOutput *output, bool value)
+{
+    Step step = {SetOutput,nullptr,output,value?1.0:0.0};
+    steps.append(step);
+    return *this;
+}
+
+XtMotionSequence &XtMotionSequence::delay(int ms)
+{
+    Step step = {Delay,nullptr,nullptr,double(ms)};
+    steps.append(step);
+    return *this;
+}
+
+bool XtMotionSequence::isEmpty() const
+{
+    return steps.isEmpty();
+}
+
+bool XtMotionHandle::isValid() const
+{
+    return !job.isNull();
+}
+
+bool XtMotionHandle::isFinished() const
+{
+    return job.isNull()||XtMotionExecutor::instance()->isJobFinished(job);
+}
+
+bool XtMotionHandle::wait(int timeout) const
+{
+    if(job.isNull())
+        return false;
+    return XtMotionExecutor::instance()->waitJob(job,timeout);
+}
+
+bool XtMotionHandle::result() const
+{
+    return isFinished()&&!job.isNull()&&job->result;
+}
+
+QString XtMotionHandle::errorMessage() const
+{
+    if(job.isNull())
+        return "invalid motion handle";
+    return isFinished()?job->message:QString();
+}
+
+XtMotionHandle XtMotionHandle::then(const XtMotionSequence &sequence, int timeout) const
+{
+    return XtMotionExecutor::instance()->submit(sequence,*this,timeout);
+}
+
+XtMotionExecutor::XtMotionExecutor()
+{
+}
+
+XtMotionExecutor::~XtMotionExecutor()
+{
+    stopThd();
+}
+
+XtMotionExecutor *XtMotionExecutor::instance()
+{
+    static XtMotionExecutor executor;
+    return &executor;
+}
+
+void XtMotionExecutor::setThreadCount(int count)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(threadsAllocated)
+    {
+        qWarning("motion executor thread resources already allocated, count %d",freeThreads.size());
+        return;
+    }
+    threadCount = qMax(1,count);
+}
+
+XtMotionHandle XtMotionExecutor::submit(const XtMotionSequence &sequence, int timeout)
+{
+    return submit(sequence,XtMotionHandle(),timeout);
+}
+
+XtMotionHandle XtMotionExecutor::submit(const XtMotionSequence &sequence, const XtMotionHandle &after, int timeout)
+{
+    XtMotionHandle handle;
+    handle.job = QSharedPointer<XtMotionJob>(new XtMotionJob());
+    handle.job->sequence = sequence;
+    handle.job->after = after.job;
+    handle.job->timeout = timeout;
+    QMutexLocker tmpLocker(&locker);
+    //线程资源在第一次提交时分配, 此时各模块的资源已经分配完
+    if(!threadsAllocated)
+    {
+        for (int i = 0; i < threadCount; ++i)
+            freeThreads.append(XtMotor::GetThreadResource());
+        waiters.setMaxThreadCount(threadCount);
+        threadsAllocated = true;
+    }
+    if(!isRunning())
+    {
+        isRun = true;
+        start(QThread::HighPriority);
+    }
+    jobs.append(handle.job);
+    jobAdded.wakeAll();
+    return handle;
+}
+
+bool XtMotionExecutor::waitJob(const QSharedPointer<XtMotionJob> &job, int timeout)
+{
+    QElapsedTimer timer; timer.start();
+    QMutexLocker tmpLocker(&locker);
+    while (job->state != XtMotionJob::Finished) {
+        qint64 left = timeout - timer.elapsed();
+        if(left <= 0)
+            return false;
+        job->finished.wait(&locker,ulong(left));
+    }
+    return job->result;
+}
+
+bool XtMotionExecutor::isJobFinished(const QSharedPointer<XtMotionJob> &job)
+{
+    QMutexLocker tmpLocker(&locker);
+    return job->state == XtMotionJob::Finished;
+}
+
+void XtMotionExecutor::stopThd()
+{
+    locker.lock();
+    isRun = false;
+    jobAdded.wakeAll();
+    locker.unlock();
+    this->wait();
+}
+
+void XtMotionExecutor::run()
+{
+    QMutexLocker tmpLocker(&locker);
+    while (isRun) {
+        for (int i = jobs.size() - 1; i >= 0; --i) {
+            if(jobs[i]->state == XtMotionJob::Finished)
+                jobs.removeAt(i);
+        }
+        QList<QSharedPointer<XtMotionJob>> ready;
+        QList<QSharedPointer<XtMotionJob>> expired;
+        int free_count = freeThreads.size();
+        qint64 next_timeout = -1;
+        foreach (QSharedPointer<XtMotionJob> job, jobs) {
+            if(job->state == XtMotionJob::Waiting)
+            {
+                if(!job->after.isNull()&&job->after->state != XtMotionJob::Finished)
+                    continue;
+                //前序失败的任务不占线程资源
+                if(!job->after.isNull()&&!job->after->result)
+                    ready.append(job);
+                else if(free_count > 0)
+                {
+                    free_count--;
+                    ready.append(job);
+                }
+            }
+            else if(!job->aborting)
+            {
+                qint64 left = job->timeout - job->timer.elapsed();
+                if(left <= 0)
+                    expired.append(job);
+                else if(next_timeout < 0||left < next_timeout)
+                    next_timeout = left;
+            }
+        }
+        if(ready.isEmpty()&&expired.isEmpty())
+        {
+            //等待提交/完成/线程释放, 有运行中的任务时最多等到最近的超时
+            if(next_timeout < 0)
+                jobAdded.wait(&locker);
+            else
+                jobAdded.wait(&locker,ulong(next_timeout));
+            continue;
+        }
+        tmpLocker.unlock();
+        foreach (QSharedPointer<XtMotionJob> job, expired)
+            abort(job);
+        foreach (QSharedPointer<XtMotionJob> job, ready)
+            dispatch(job);
+        tmpLocker.relock();
+    }
+}
+
+void XtMotionExecutor::dispatch(const QSharedPointer<XtMotionJob> &job)
+{
+    if(!job->after.isNull()&&!job->after->result)
+    {
+        finish(job,false,QString("previous sequence failed: ").append(job->after->message));
+        return;
+    }
+    {
+        QMutexLocker tmpLocker(&locker);
+        if(freeThreads.isEmpty())
+            return;
+        job->thread = freeThreads.takeFirst();
+    }
+    job->timer.start();
+    if(!issue(job))
+    {
+        releaseThread(job);
+        return;
+    }
+    setState(job,XtMotionJob::Running);
+    QtConcurrent::run(&waiters,[this,job]() { waitIssued(job); });
+}
+
+bool XtMotionExecutor::issue(const QSharedPointer<XtMotionJob> &job)
+{
+    foreach (XtMotionSequence::Step step, job->sequence.steps) {
+        switch (step.type) {
+        case XtMotionSequence::Move:
+            if(!step.motor->SGO(step.value,job->thread))
+            {
+                //已下发的运动一并停止
+                XT_Controler::ClearInsBuffer(job->thread);
+                for (int i = 0; i < job->targets.size(); ++i)
+                    XT_Controler::STOP_S(job->thread,job->targets[i].first->AxisId());
+                finish(job,false,QString("%1 move to %2 fail: %3").arg(step.motor->Name()).arg(step.value).arg(step.motor->GetCurrentError()));
+                return false;
+            }
+            job->targets.append(QPair<XtMotor*,double>(step.motor,step.value));
+            break;
+        case XtMotionSequence::WaitStop:
+            step.motor->TILLSTOP(job->thread);
+            break;
+        case XtMotionSequence::SetOutput:
+            step.output->SET(step.value > 0,job->thread);
+            break;
+        case XtMotionSequence::Delay:
+            XT_Controler::TILLTIME(job->thread,int(step.value));
+            break;
+        }
+    }
+    return true;
+}
+
+void XtMotionExecutor::waitIssued(const QSharedPointer<XtMotionJob> &job)
+{
+    //超时由调度线程清空指令缓存, 这里随之返回
+    XT_Controler::WaitForAllInsFinish(job->thread);
+    setState(job,XtMotionJob::Arriving);
+    //指令执行完后再由运动监视线程确认各轴反馈到位
+    bool arrived = true;
+    for (int i = 0; i < job->targets.size() && arrived; ++i) {
+        XtMotor *motor = job->targets[i].first;
+        double target = job->targets[i].second;
+        double error = motor->parameters.positionError();
+        double position;
+        int left = int(job->timeout - job->timer.elapsed());
+        arrived = left > 0&&XtMotionMonitor::instance()->waitPosition(motor,[target,error](double pos) {
+            return fabs(pos - target) <= error;
+        },left,position);
+    }
+    if(arrived)
+        finish(job,true,"");
+    else
+        abort(job);
+    releaseThread(job);
+}
+
+void XtMotionExecutor::abort(const QSharedPointer<XtMotionJob> &job)
+{
+    {
+        QMutexLocker tmpLocker(&locker);
+        if(job->state == XtMotionJob::Finished||job->aborting)
+            return;
+        job->aborting = true;
+    }
+    XT_Controler::ClearInsBuffer(job->thread);
+    QString message = "timeout";
+    for (int i = 0; i < job->targets.size(); ++i) {
+        XtMotor *motor = job->targets[i].first;
+        XT_Controler::STOP_S(job->thread,motor->AxisId());
+        motor->SetCurrentTragetPos(motor->GetFeedbackPos());
+        message.append(QString(" %1 target %2 current %3").arg(motor->Name()).arg(job->targets[i].second).arg(motor->GetFeedbackPos()));
+    }
+    finish(job,false,message);
+}
+
+void XtMotionExecutor::setState(const QSharedPointer<XtMotionJob> &job, XtMotionJob::JobState state)
+{
+    QMutexLocker tmpLocker(&locker);
+    if(job->state != XtMotionJob::Finished)
+        job->state = state;
+}
+
+void XtMotionExecutor::finish(const QSharedPointer<XtMotionJob> &job, bool result, QString message)
+{
+    QMutexLocker tmpLocker(&locker);
+    //超时中止和正常完成可能同时到达, 以先到的为准; 中止中只接受中止的结果
+    if(job->state == XtMotionJob::Finished||(job->aborting&&result))
+        return;
+    if(!result)
+        qWarning("motion sequence on thread %d fail: %s",job->thread,message.toStdString().c_str());
+    job->result = result;
+    job->message = message;
+    job->state = XtMotionJob::Finished;
+    job->finished.wakeAll();
+    jobAdded.wakeAll();
+}
+
+void XtMotionExecutor::releaseThread(const QSharedPointer<XtMotionJob> &job)
+{
+    QMutexLocker tmpLocker(&locker);
+    //中止完成前线程资源不能交给下一个任务
+    while (job->state != XtMotionJob::Finished)
+        job->finished.wait(&locker);
+    if(job->thread >= 0)
+        freeThreads.append(job->thread);
+    job->thread = -1;
+    jobAdded.wakeAll();
+}
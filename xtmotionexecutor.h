@@ -0,0 +1,139 @@
+#ifndef XTMOTIONEXECUTOR_H
+#define XTMOTIONEXECUTOR_H
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QMutex>
+#include <QPair>
+#include <QSharedPointer>
+#include <QString>
+#include <QThread>
+#include <QThreadPool>
+#include <QWaitCondition>
+
+class XtMotor;
+class XtGeneralOutput;
+class XtMotionJob;
+
+/*
+ * Instruction sequence for one XT controller thread.
+ * The moves are checked against the limits when the sequence is issued,
+ * so a move whose interference check depends on an earlier move having
+ * finished belongs in a chained sequence, not after a waitStop.
+ */
+class XtMotionSequence
+{
+public:
+    XtMotionSequence &move(XtMotor *motor, double pos);
+    XtMotionSequence &waitStop(XtMotor *motor);
+    XtMotionSequence &moveAndWait(XtMotor *motor, double pos);
+    XtMotionSequence &setOutput(XtGeneralOutput *output, bool value);
+    XtMotionSequence &delay(int ms);
+    bool isEmpty() const;
+
+private:
+    friend class XtMotionExecutor;
+    enum StepType
+    {
+        Move,
+        WaitStop,
+        SetOutput,
+        Delay
+    };
+    struct Step
+    {
+        StepType type;
+        XtMotor *motor;
+        XtGeneralOutput *output;
+        double value;
+    };
+    QList<Step> steps;
+};
+
+class XtMotionHandle
+{
+public:
+    bool isValid() const;
+    bool isFinished() const;
+    bool wait(int timeout = 30000) const;
+    bool result() const;
+    QString errorMessage() const;
+    XtMotionHandle then(const XtMotionSequence &sequence, int timeout = 30000) const;
+
+private:
+    friend class XtMotionExecutor;
+    QSharedPointer<XtMotionJob> job;
+};
+
+class XtMotionJob
+{
+public:
+    enum JobState
+    {
+        Waiting,
+        Running,
+        Arriving,
+        Finished
+    };
+    XtMotionSequence sequence;
+    QSharedPointer<XtMotionJob> after;
+    int timeout = 30000;
+    JobState state = Waiting;
+    bool result = false;
+    QString message;
+    int thread = -1;
+    bool aborting = false;
+    QElapsedTimer timer;
+    QList<QPair<XtMotor*,double>> targets;
+    QWaitCondition finished;
+};
+
+/*
+ * Runs submitted sequences on a pool of XT thread resources and returns
+ * a handle right away. Sequences on different resources run in parallel;
+ * a chained sequence is issued once its predecessor has finished and every
+ * moved axis has arrived at its target.
+ * Each issued sequence is waited on by a task that blocks in the controller
+ * until the thread program ends and then in the motion monitor until the
+ * axes arrive; the dispatcher itself only wakes on submit, completion or
+ * the nearest timeout.
+ */
+class XtMotionExecutor:public QThread
+{
+    Q_OBJECT
+
+public:
+    static XtMotionExecutor *instance();
+    ~XtMotionExecutor() override;
+
+    void setThreadCount(int count);
+    XtMotionHandle submit(const XtMotionSequence &sequence, int timeout = 30000);
+    XtMotionHandle submit(const XtMotionSequence &sequence, const XtMotionHandle &after, int timeout = 30000);
+    bool waitJob(const QSharedPointer<XtMotionJob> &job, int timeout);
+    bool isJobFinished(const QSharedPointer<XtMotionJob> &job);
+    void stopThd();
+
+protected:
+    void run() override;
+
+private:
+    explicit XtMotionExecutor();
+    void dispatch(const QSharedPointer<XtMotionJob> &job);
+    bool issue(const QSharedPointer<XtMotionJob> &job);
+    void waitIssued(const QSharedPointer<XtMotionJob> &job);
+    void abort(const QSharedPointer<XtMotionJob> &job);
+    void setState(const QSharedPointer<XtMotionJob> &job, XtMotionJob::JobState state);
+    void finish(const QSharedPointer<XtMotionJob> &job, bool result, QString message);
+    void releaseThread(const QSharedPointer<XtMotionJob> &job);
+
+    bool isRun = false;
+    int threadCount = 4;
+    bool threadsAllocated = false;
+    QList<int> freeThreads;
+    QList<QSharedPointer<XtMotionJob>> jobs;
+    QThreadPool waiters;
+    QMutex locker;
+    QWaitCondition jobAdded;
+};
+
+#endif // XTMOTIONEXECUTOR_H
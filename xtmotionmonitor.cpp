@@ -0,0 +1,122 @@
+#include "xtmotionmonitor.h"
+#include "xtmotor.h"
+#include <QElapsedTimer>
+#include <QHash>
+
+XtMotionMonitor::XtMotionMonitor()
+{
+}
+
+XtMotionMonitor::~XtMotionMonitor()
+{
+    stopThd();
+}
+
+XtMotionMonitor *XtMotionMonitor::instance()
+{
+    static XtMotionMonitor monitor;
+    if(!monitor.isRunning())
+    {
+        QMutexLocker tmpLocker(&monitor.waiterLocker);
+        if(!monitor.isRunning())
+        {
+            monitor.isRun = true;
+            monitor.start(QThread::HighPriority);
+        }
+    }
+    return &monitor;
+}
+
+XtMotionMonitor::MotionEvent XtMotionMonitor::waitEvent(XtMotor *motor, int events, PositionCondition condition, int timeout, double &position, bool *sampled)
+{
+    QElapsedTimer timer; timer.start();
+    Waiter waiter;
+    waiter.motor = motor;
+    waiter.events = condition?events:(events&~ArrivedEvent);
+    waiter.condition = condition;
+    waiter.event = NoEvent;
+    waiter.sampled = false;
+    waiter.position = 0;
+
+    QMutexLocker tmpLocker(&waiterLocker);
+    waiters.append(&waiter);
+    waiterAdded.wakeAll();
+    while (waiter.event == NoEvent) {
+        qint64 left = timeout - timer.elapsed();
+        if(left <= 0)
+            break;
+        waiter.wake.wait(&waiterLocker, ulong(left));
+    }
+    waiters.removeOne(&waiter);
+    tmpLocker.unlock();
+    if(sampled != nullptr)
+        *sampled = waiter.sampled;
+    position = waiter.sampled?waiter.position:motor->GetFeedbackPos();
+    return waiter.event;
+}
+
+bool XtMotionMonitor::waitPosition(XtMotor *motor, PositionCondition condition, int timeout, double &position, bool *sampled)
+{
+    return waitEvent(motor,ArrivedEvent,condition,timeout,position,sampled) == ArrivedEvent;
+}
+
+void XtMotionMonitor::stopThd()
+{
+    waiterLocker.lock();
+    isRun = false;
+    waiterAdded.wakeAll();
+    waiterLocker.unlock();
+    this->wait();
+}
+
+void XtMotionMonitor::run()
+{
+    QMutexLocker tmpLocker(&waiterLocker);
+    while (isRun) {
+        if(waiters.isEmpty())
+        {
+            waiterAdded.wait(&waiterLocker);
+            continue;
+        }
+        //each waited axis is read once per cycle however many threads wait on it
+        QHash<XtMotor*, int> motors;
+        foreach (Waiter *waiter, waiters)
+            motors[waiter->motor] |= waiter->events;
+        tmpLocker.unlock();
+        QHash<XtMotor*, AxisSample> samples;
+        for (auto it = motors.constBegin(); it != motors.constEnd(); ++it) {
+            AxisSample sample;
+            sample.position = it.key()->GetFeedbackPos();
+            sample.stopped = (it.value()&StoppedEvent)&&it.key()->IsMoveFinished();
+            sample.fault = (it.value()&FaultEvent)&&it.key()->getAlarmState();
+            samples.insert(it.key(), sample);
+        }
+        tmpLocker.relock();
+        //published after the waiters are woken and the lock released
+        QList<QPair<XtMotor*, MotionEvent>> happened;
+        foreach (Waiter *waiter, waiters) {
+            if(waiter->event != NoEvent || !samples.contains(waiter->motor))
+                continue;
+            const AxisSample &sample = samples[waiter->motor];
+            waiter->position = sample.position;
+            waiter->sampled = true;
+            //fault first so a stop caused by the alarm is not reported as a normal stop
+            if((waiter->events&FaultEvent)&&sample.fault)
+                waiter->event = FaultEvent;
+            else if((waiter->events&StoppedEvent)&&sample.stopped)
+                waiter->event = StoppedEvent;
+            else if((waiter->events&ArrivedEvent)&&waiter->condition(sample.position))
+                waiter->event = ArrivedEvent;
+            if(waiter->event != NoEvent)
+            {
+                happened.append(qMakePair(waiter->motor, waiter->event));
+                waiter->wake.wakeAll();
+            }
+        }
+        tmpLocker.unlock();
+        for (const auto &item : happened)
+            emit motionEvent(item.first->Name(), item.second, samples[item.first].position);
+        msleep(SAMPLE_INTERVAL);
+        tmpLocker.relock();
+    }
+}
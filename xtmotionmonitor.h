@@ -0,0 +1,76 @@
+#ifndef XTMOTIONMONITOR_H
+#define XTMOTIONMONITOR_H
+
+#include <QThread>
+#include <QList>
+#include <QMutex>
+#include <QWaitCondition>
+#include <functional>
+
+class XtMotor;
+
+/*
+ * Single sampler of the axis motion events.
+ * Waiting threads register the events they wait for and sleep on their own
+ * condition variable; the monitor reads each waited axis once per cycle
+ * (feedback position, and the stop/alarm state only when someone waits for
+ * them), wakes the waiters whose event happened and publishes it through
+ * motionEvent.
+ */
+class XtMotionMonitor:public QThread
+{
+    Q_OBJECT
+
+public:
+    enum MotionEvent
+    {
+        NoEvent = 0,
+        ArrivedEvent = 1,   //position condition met
+        StoppedEvent = 2,   //instruction buffer of the axis thread drained
+        FaultEvent = 4      //servo alarm
+    };
+    typedef std::function<bool(double position)> PositionCondition;
+
+    static XtMotionMonitor *instance();
+    ~XtMotionMonitor() override;
+
+    //returns the first event out of events that happened, NoEvent on timeout
+    //if no sample was taken before the timeout, position is read directly and sampled is false
+    MotionEvent waitEvent(XtMotor *motor, int events, PositionCondition condition, int timeout, double &position, bool *sampled = nullptr);
+    bool waitPosition(XtMotor *motor, PositionCondition condition, int timeout, double &position, bool *sampled = nullptr);
+    void stopThd();
+
+signals:
+    void motionEvent(QString axis, int event, double position);
+
+protected:
+    void run() override;
+
+private:
+    explicit XtMotionMonitor();
+
+    struct Waiter
+    {
+        XtMotor *motor;
+        int events;
+        PositionCondition condition;
+        MotionEvent event;
+        bool sampled;
+        double position;
+        QWaitCondition wake;
+    };
+    struct AxisSample
+    {
+        double position;
+        bool stopped;
+        bool fault;
+    };
+
+    const ulong SAMPLE_INTERVAL = 1;
+    bool isRun = false;
+    QList<Waiter*> waiters;
+    QMutex waiterLocker;
+    QWaitCondition waiterAdded;
+};
+
+#endif // XTMOTIONMONITOR_H
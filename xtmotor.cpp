@@ -1,9 +1,12 @@
 ﻿#include "XtGeneralInput.h"
 #include "XtGeneralOutput.h"
 #include "xtmotor.h"
+#include "xtmotionmonitor.h"
 #include "XT_MotionControler_Client_Lib.h"
 #include "XT_MotionControlerExtend_Client_Lib.h"
 #include "config.h"
+#include "cycletracerecorder.h"
+#include <QElapsedTimer>
 
 using namespace XT_Controler_Extend;
 int XtMotor::curve_resource = 0;
@@ -14,6 +17,8 @@ XtMotor::XtMotor()
     axis_id = -1;
     name = "";
     is_init = false;
+    current_target = 0;
+    timing_record.arrived = 0;
 //    limit_parameters.append(new MotorLimitParameter());
 //    limit_parameters.append(new MotorLimitParameter());
 //    io_limit_parameters.append(new IOLimitParameter());
@@ -250,6 +255,15 @@ bool XtMotor::IsRunning() const
     return be_run == 1;
 }
 
+bool XtMotor::IsMoveFinished() const
+{
+    if(!is_init)
+        return true;
+    int buffer_len, finish;
+    XT_Controler::GetThreadInsBufferRemainCount(default_using_thread, buffer_len, finish);
+    return buffer_len == 0 && finish == 1;
+}
+
 bool XtMotor::checkAlarm()
 {
     if(getAlarmState())
@@ -427,6 +441,7 @@ bool XtMotor::MoveToPos(double pos,int thread)
     if(!(checkState()&&checkLimit(pos)&&checkInterface(pos)))return false;
     if(thread==-1)
         thread = default_using_thread;
+    openTimingRecord(MotionTimingRecorder::NormalMove,current_target,pos,max_vel);
     XT_Controler::SGO(thread, axis_id, pos);
     XT_Controler::TILLSTOP(thread, axis_id);
     current_target = pos;
@@ -441,6 +456,7 @@ bool XtMotor::SlowMoveToPos(double pos, double low_vel, int thread)
         thread = default_using_thread;
     if(low_vel > max_vel)
         low_vel = max_vel;
+    openTimingRecord(MotionTimingRecorder::SlowMove,current_target,pos,low_vel);
     XT_Controler::SET_MAX_VEL(thread,axis_id,low_vel);
     XT_Controler::SGO(thread, axis_id, pos);
     XT_Controler::TILLSTOP(thread, axis_id);
@@ -482,17 +498,14 @@ bool XtMotor::WaitMoveStop(int timeout)
     if(is_debug)return true;
     if(!(checkState(false)))return false;
     int thread = default_using_thread;
-    int buffer_len, finish;
-    while(timeout>0)
-    {
-        XT_Controler::GetThreadInsBufferRemainCount(thread, buffer_len, finish);
-        if (buffer_len == 0 && finish == 1)
-        {
-            return true;
-        }
-        timeout-=1;
-        QThread::msleep(1);
-    }
+    double current_position;
+    XtMotionMonitor::MotionEvent event = XtMotionMonitor::instance()->waitEvent(this,XtMotionMonitor::StoppedEvent|XtMotionMonitor::FaultEvent,nullptr,timeout,current_position);
+    if(event == XtMotionMonitor::StoppedEvent)
+        return true;
+    if(event == XtMotionMonitor::FaultEvent)
+        checkAlarm();
+    else
+        qInfo("%s wait move stop time out, current_position:%f",name.toStdString().c_str(),current_position);
     XT_Controler::ClearInsBuffer(thread);
     XT_Controler::STOP_S(thread, axis_id);
     return false;
@@ -502,20 +515,28 @@ bool XtMotor::WaitArrivedTargetPos(double target_position, int timeout)
 {
     if(is_debug)return true;
     if(!(checkState()))return false;
-    int current = 0;
-    while (fabs(GetFeedbackPos() - target_position) > parameters.positionError()) {
-        if(current > timeout)
-        {
-            qInfo("%s wait target_position:%f time out, current_position:%f",name.toStdString().c_str(),target_position,GetFeedbackPos());
-            current_target = GetFeedbackPos();
-            return false;
-        }
-        Sleep(10);
-        current+=10;
+    TraceSpan trace_span("motion",__FUNCTION__,name);
+    double position_error = parameters.positionError();
+    double current_position;
+    bool sampled = false;
+    if(!XtMotionMonitor::instance()->waitPosition(this,[target_position,position_error](double position){return fabs(position - target_position) <= position_error;},timeout,current_position,&sampled))
+    {
+        qInfo("%s wait target_position:%f time out, current_position:%f",name.toStdString().c_str(),target_position,current_position);
+        //没有采样时不改写目标位置
+        if(sampled)
+            current_target = current_position;
+        closeTimingRecord(target_position,false);
+        return false;
     }
 //    qInfo("%s arrived %f time %d",name.toStdString().c_str(),target_position,current);
     if(parameters.useDelay())
-        Sleep(parameters.arrivedDelay());
+    {
+        QElapsedTimer timer; timer.start();
+        WaitSettled(parameters.arrivedDelay());
+        closeTimingRecord(target_position,true,timer.nsecsElapsed()/1000000.0);
+    }
+    else
+        closeTimingRecord(target_position,true);
 //    current_target = GetFeedbackPos();
     return true;
 }
@@ -524,15 +545,11 @@ bool XtMotor::WaitLessThanTargetPos(double target_position, int timeout)
 {
     if(is_debug)return true;
     if(!(checkState()))return false;
-    int current = 0;
-    while (GetFeedbackPos() > target_position) {
-        if(current > timeout)
-        {
-            qInfo("%s wait less than target_position:%f time out, current_position:%f",name.toStdString().c_str(),target_position,GetFeedbackPos());
-            return false;
-        }
-        Sleep(10);
-        current+=10;
+    double current_position;
+    if(!XtMotionMonitor::instance()->waitPosition(this,[target_position](double position){return position <= target_position;},timeout,current_position))
+    {
+        qInfo("%s wait less than target_position:%f time out, current_position:%f",name.toStdString().c_str(),target_position,current_position);
+        return false;
     }
     return true;
 }
@@ -541,17 +558,20 @@ bool XtMotor::WaitArrivedTargetPos(double target_position, double arived_error,
 {
     if(is_debug)return true;
     if(!(checkState()))return false;
-    int current = 0;
-    while (fabs(GetFeedbackPos() - target_position) > arived_error) {
-        if(current > timeout)
-        {
-            qInfo("%s wait target_position:%f time out, current_position:%f",name.toStdString().c_str(),target_position,GetFeedbackPos());
-            current_target = GetFeedbackPos();
-            return false;
-        }
-        Sleep(10);
-        current+=10;
+    TraceSpan trace_span("motion",__FUNCTION__,name);
+    double current_position;
+    bool sampled = false;
+    if(!XtMotionMonitor::instance()->waitPosition(this,[target_position,arived_error](double position){return fabs(position - target_position) <= arived_error;},timeout,current_position,&sampled))
+    {
+        qInfo("%s wait target_position:%f time out, current_position:%f",name.toStdString().c_str(),target_position,current_position);
+        if(sampled)
+            current_target = current_position;
+        closeTimingRecord(target_position,false);
+        return false;
     }
+    //放宽误差的提前等待不结束计时, 由之后的到位等待记录
+    if(arived_error <= parameters.positionError())
+        closeTimingRecord(target_position,true);
     return true;
 }
 
@@ -560,6 +580,60 @@ bool XtMotor::WaitArrivedTargetPos(int timeout)
     return  WaitArrivedTargetPos(current_target,timeout);
 }
 
+bool XtMotor::WaitSettled(double band, int window, int max_wait)
+{
+    if(is_debug)return true;
+    if(!(checkState()))return false;
+    TraceSpan trace_span("motion",__FUNCTION__,name);
+    QElapsedTimer timer; timer.start();
+    bool started = false;
+    qint64 window_start = 0;
+    double min_position = 0,max_position = 0;
+    double current_position;
+    bool settled = XtMotionMonitor::instance()->waitPosition(this,[&](double position){
+        qint64 current = timer.elapsed();
+        //超出区间则从这一采样重新计时
+        if(!started||qMax(max_position,position) - qMin(min_position,position) > band)
+        {
+            started = true;
+            window_start = current;
+            min_position = position;
+            max_position = position;
+            return false;
+        }
+        min_position = qMin(min_position,position);
+        max_position = qMax(max_position,position);
+        return current - window_start >= window;
+    },max_wait,current_position);
+    double wait_time = timer.nsecsElapsed()/1000000.0;
+    settle_count++;
+    settle_wait_time += wait_time;
+    if(settled)
+        settle_saved_time += qMax(0.0,max_wait - wait_time);
+    else
+        settle_fallback_count++;
+    if(settle_count >= 100)
+    {
+        qInfo("%s settle %d moves avg wait %f ms avg saved %f ms fallback %d",name.toStdString().c_str(),settle_count,
+              settle_wait_time/settle_count,settle_saved_time/settle_count,settle_fallback_count);
+        settle_count = 0;
+        settle_fallback_count = 0;
+        settle_wait_time = 0;
+        settle_saved_time = 0;
+    }
+    return settled;
+}
+
+bool XtMotor::WaitSettled(int max_wait)
+{
+    if(parameters.settleBand() <= 0)
+    {
+        Sleep(max_wait);
+        return true;
+    }
+    return WaitSettled(parameters.settleBand(),parameters.settleWindow(),max_wait);
+}
+
 
 bool XtMotor::MoveToPosSync(double pos, int thread,int time_out)
 {
@@ -618,7 +692,10 @@ bool XtMotor::MoveToPosSafty(double pos,int thread)
     if(thread==-1)
         thread = default_using_thread;
     if(abs(current_target -limit_pos)> 0.000001)
+    {
+        openTimingRecord(MotionTimingRecorder::SaftyMove,current_target,limit_pos,max_vel);
         XT_Controler::SGO(thread, axis_id, limit_pos);
+    }
     current_target = limit_pos;
     return true;
 }
@@ -693,11 +770,13 @@ bool XtMotor::StepMove(double step, int thread)
     if(!checkLimit(GetFeedbackPos() + step))return false;
     if(thread==-1)
         thread = default_using_thread;
+    double start_pos = GetFeedbackPos();
+    openTimingRecord(MotionTimingRecorder::StepMove,start_pos,start_pos + step,max_vel);
     if(step>0)
         XT_Controler_Extend::SGO_INCREASE_LIMIT(thread, axis_id, step, max_range);
     else
         XT_Controler_Extend::SGO_INCREASE_LIMIT(thread, axis_id, step, min_range);
-    current_target = GetFeedbackPos() + step;
+    current_target = start_pos + step;
     return true;
 }
 
@@ -1003,6 +1082,8 @@ bool XtMotor::getInterfaceLimit(double target_pos,double& result_pos)
 {
     if(parallel_limit_parameters.size()<=0)
         return false;
+    if(!limit_index.isCompiled(vertical_limit_parameters.size(),parallel_limit_parameters.size(),io_limit_parameters.size()))
+        compileLimitIndex();
     result_pos = target_pos;
     for (int i = 0; i < parallel_limit_parameters.size(); ++i) {
         ParallelLimitParameter * temp_parameter = parallel_limit_parameters[i];
@@ -1028,7 +1109,7 @@ bool XtMotor::getInterfaceLimit(double target_pos,double& result_pos)
 //            start_y = parallel_limit_motors[3*i+2]->GetFeedbackPos();
 //            end_y = parallel_limit_motors[3*i+2]->GetCurrentTragetPos();
         }
-        if(temp_parameter->hasInInterferenceSpance(start_x,end_x,start_y,end_y))
+        if(limit_index.parallelInInterference(i,start_x,end_x,start_y,end_y))
         {
             DeviceStatesGeter::motorState motor_state = geter->getMotorState(temp_parameter->motorName());
             if(!motor_state.result)
@@ -1048,22 +1129,21 @@ bool XtMotor::checkInterface(const double pos)
 {
 //    qInfo("%s CheckLimit %d,%d,%d",name.toStdString().c_str(),vertical_limit_parameters.size(),parallel_limit_parameters.size(),io_limit_parameters.size());
     double current_pos = GetFeedbackPos();
-    for (int i = 0; i < vertical_limit_parameters.size(); ++i) {
+    if(!limit_index.isCompiled(vertical_limit_parameters.size(),parallel_limit_parameters.size(),io_limit_parameters.size()))
+        compileLimitIndex();
+    //只检查运动区间与检测区间有干涉的限制
+    foreach (int i, limit_index.verticalCandidates(current_pos,pos)) {
         VerticalLimitParameter* temp_parameter = vertical_limit_parameters[i];
-        //与检测区间有干涉
-        if(temp_parameter->hasInterferenceWithMoveSpance(current_pos,pos))
+        //在限制区间
+        DeviceStatesGeter::motorState motor_state = geter->getMotorState(temp_parameter->motorName());
+        if(!motor_state.result)
+            return false;
+        if(!limit_index.verticalInLimit(i,motor_state.current_position,motor_state.target_position))
         {
-            //在限制区间
-            DeviceStatesGeter::motorState motor_state = geter->getMotorState(temp_parameter->motorName());
-            if(!motor_state.result)
-                return false;
-            if(!temp_parameter->checkInLimitSpance(motor_state.current_position,motor_state.target_position))
-            {
-                QString errorMessage = QString( u8"%1从%2到%3的过程可能会与%4相撞").arg(name).arg(current_pos).arg(pos).arg(temp_parameter->motorName());
-                AppendError(errorMessage);
-                qCritical(errorMessage.toStdString().c_str());
-                return false;
-            }
+            QString errorMessage = QString( u8"%1从%2到%3的过程可能会与%4相撞").arg(name).arg(current_pos).arg(pos).arg(temp_parameter->motorName());
+            AppendError(errorMessage);
+            qCritical(errorMessage.toStdString().c_str());
+            return false;
         }
     }
     for (int i = 0; i < parallel_limit_parameters.size(); ++i) {
@@ -1090,7 +1170,7 @@ bool XtMotor::checkInterface(const double pos)
 //            start_y = parallel_limit_motors[3*i+2]->GetFeedbackPos();
 //            end_y = parallel_limit_motors[3*i+2]->GetCurrentTragetPos();
         }
-        if(temp_parameter->hasInInterferenceSpance(start_x,end_x,start_y,end_y))
+        if(limit_index.parallelInInterference(i,start_x,end_x,start_y,end_y))
         {
             //检测在安全距离
             DeviceStatesGeter::motorState motor_state = geter->getMotorState(temp_parameter->motorName());
@@ -1103,76 +1183,72 @@ bool XtMotor::checkInterface(const double pos)
             }
         }
     }
-    for (int i = 0; i < io_limit_parameters.size(); ++i) {
+    foreach (int i, limit_index.ioCandidates(current_pos,pos)) {
         IOLimitParameter* temp_parameter = io_limit_parameters[i];
-        //与检测区间有干涉
-        if(temp_parameter->hasInterferenceWithMoveSpance(current_pos,pos))
+        //在限制区间
+        if(temp_parameter->crashSpance())
         {
-            //在限制区间
-            if(temp_parameter->crashSpance())
+            bool result = true,temp_result;
+            QString temp_name = "",temp_io;
+            for(int i = 0; i < temp_parameter->inputIOName().size(); ++i)
             {
-                bool result = true,temp_result;
-                QString temp_name = "",temp_io;
-                for(int i = 0; i < temp_parameter->inputIOName().size(); ++i)
+                temp_io =  temp_parameter->inputIOName()[i].toString();
+                DeviceStatesGeter::IoState io_state = geter->getInputIoState(temp_io);
+                if(!io_state.result)
+                    return false;
+                temp_result = temp_parameter->checkInputInLimitSpance(i,io_state.current_state);
+                if(!temp_result)
                 {
-                    temp_io =  temp_parameter->inputIOName()[i].toString();
-                    DeviceStatesGeter::IoState io_state = geter->getInputIoState(temp_io);
-                    if(!io_state.result)
-                        return false;
-                    temp_result = temp_parameter->checkInputInLimitSpance(i,io_state.current_state);
-                    if(!temp_result)
-                    {
-                        temp_name.append(temp_io);
-                        temp_name.append(" ");
-                        result = false;
-                    }
+                    temp_name.append(temp_io);
+                    temp_name.append(" ");
+                    result = false;
                 }
-                for (int i = 0; i < temp_parameter->outputIOName().size(); ++i)
+            }
+            for (int i = 0; i < temp_parameter->outputIOName().size(); ++i)
+            {
+                temp_io =  temp_parameter->outputIOName()[i].toString();
+                DeviceStatesGeter::IoState io_state = geter->getOutputIoState(temp_io);
+                if(!io_state.result)
+                    return false;
+                temp_result = temp_parameter->checkOutputLimitSpance(i,io_state.current_state);
+                if(!temp_result)
                 {
-                    temp_io =  temp_parameter->outputIOName()[i].toString();
-                    DeviceStatesGeter::IoState io_state = geter->getOutputIoState(temp_io);
-                    if(!io_state.result)
-                        return false;
-                    temp_result = temp_parameter->checkOutputLimitSpance(i,io_state.current_state);
-                    if(!temp_result)
-                    {
-                        temp_name.append(temp_io);
-                        temp_name.append(" ");
-                        result = false;
-                    }
+                    temp_name.append(temp_io);
+                    temp_name.append(" ");
+                    result = false;
                 }
-                if(result)
+            }
+            if(result)
+            {
+                AppendError(QString( u8"%1从%2到%3的过程可能会与%4相撞").arg(name).arg(current_pos).arg(pos).arg(temp_name));
+                return false;
+            }
+        }
+        else
+        {
+            QString temp_io;
+            for(int i = 0; i < temp_parameter->inputIOName().size(); ++i)
+            {
+                temp_io = temp_parameter->inputIOName()[i].toString();
+                DeviceStatesGeter::IoState io_state = geter->getInputIoState(temp_io);
+                if(!io_state.result)
+                    return false;
+                if(!temp_parameter->checkInputInLimitSpance(i,io_state.current_state))
                 {
-                    AppendError(QString( u8"%1从%2到%3的过程可能会与%4相撞").arg(name).arg(current_pos).arg(pos).arg(temp_name));
+                    AppendError(QString( u8"%1从%2到%3的过程可能会与%4相撞").arg(name).arg(current_pos).arg(pos).arg(temp_parameter->inputIOName()[i].toString()));
                     return false;
                 }
             }
-            else
+            for (int i = 0; i < temp_parameter->outputIOName().size(); ++i)
             {
-                QString temp_io;
-                for(int i = 0; i < temp_parameter->inputIOName().size(); ++i)
-                {
-                    temp_io = temp_parameter->inputIOName()[i].toString();
-                    DeviceStatesGeter::IoState io_state = geter->getInputIoState(temp_io);
-                    if(!io_state.result)
-                        return false;
-                    if(!temp_parameter->checkInputInLimitSpance(i,io_state.current_state))
-                    {
-                        AppendError(QString( u8"%1从%2到%3的过程可能会与%4相撞").arg(name).arg(current_pos).arg(pos).arg(temp_parameter->inputIOName()[i].toString()));
-                        return false;
-                    }
-                }
-                for (int i = 0; i < temp_parameter->outputIOName().size(); ++i)
+                temp_io =  temp_parameter->outputIOName()[i].toString();
+                DeviceStatesGeter::IoState io_state = geter->getOutputIoState(temp_io);
+                if(!io_state.result)
+                    return false;
+                if(!temp_parameter->checkOutputLimitSpance(i,io_state.current_state))
                 {
-                    temp_io =  temp_parameter->outputIOName()[i].toString();
-                    DeviceStatesGeter::IoState io_state = geter->getOutputIoState(temp_io);
-                    if(!io_state.result)
-                        return false;
-                    if(!temp_parameter->checkOutputLimitSpance(i,io_state.current_state))
-                    {
-                        AppendError(QString( u8"%1从%2到%3的过程可能会与%4相撞").arg(name).arg(current_pos).arg(pos).arg(temp_parameter->outputIOName()[i].toString()));
-                        return false;
-                    }
+                    AppendError(QString( u8"%1从%2到%3的过程可能会与%4相撞").arg(name).arg(current_pos).arg(pos).arg(temp_parameter->outputIOName()[i].toString()));
+                    return false;
                 }
             }
         }
@@ -1182,6 +1258,35 @@ bool XtMotor::checkInterface(const double pos)
 
 
 
+void XtMotor::openTimingRecord(MotionTimingRecorder::MoveType type, double start_pos, double target_pos, double vel)
+{
+    //起点用上一次下发的目标位置, 不再多读一次反馈; 下发和等待可能在不同线程
+    QMutexLocker tmpLocker(&timing_locker);
+    MotionTimingRecorder::instance()->beginMove(timing_record,name,type,start_pos,target_pos,vel,max_acc,max_jerk);
+}
+
+void XtMotor::closeTimingRecord(double target_position, bool arrived, double settle_time)
+{
+    QMutexLocker tmpLocker(&timing_locker);
+    if(MotionTimingRecorder::isOpen(timing_record)&&fabs(timing_record.targetPos - target_position) < 0.000001)
+        MotionTimingRecorder::instance()->endMove(timing_record,arrived,settle_time);
+}
+
+void XtMotor::compileLimitIndex()
+{
+    QElapsedTimer timer; timer.start();
+    limit_index.compile(vertical_limit_parameters,parallel_limit_parameters,io_limit_parameters);
+    qInfo("%s compile limit index %lld ns",name.toStdString().c_str(),timer.nsecsElapsed());
+#ifndef QT_NO_DEBUG
+    //逐条交叉核对是O(n^2), 只在调试版本里跑
+    timer.restart();
+    int mismatch = limit_index.verify(vertical_limit_parameters,parallel_limit_parameters,io_limit_parameters);
+    if(mismatch > 0)
+        qCritical("%s limit index has %d mismatches with the limit parameters",name.toStdString().c_str(),mismatch);
+    qInfo("%s verify limit index %lld ms",name.toStdString().c_str(),timer.elapsed());
+#endif
+}
+
 XtMotorExtendParameters::XtMotorExtendParameters()
 {
     m_Delay = 0;
@@ -5,11 +5,14 @@
 #include "XtGeneralOutput.h"
 #include "devicestatesgeter.h"
 #include "iolimitparameter.h"
+#include "motiontimingrecorder.h"
+#include "motorlimitindex.h"
 #include "parallellimitparameter.h"
 #include "utils/errorcode.h"
 #include "verticallimitparameter.h"
 #include "xtadcmodule.h"
 #include "xtmotorparameter.h"
+#include <QMutex>
 #include <QObject>
 #include <QString>
 #include <QTime>
@@ -58,6 +61,7 @@ public:
     virtual double GetCurAcc() const;
     virtual double GetCurADC() const;
     virtual bool IsRunning() const;
+    bool IsMoveFinished() const;
     virtual bool checkAlarm();
     virtual bool getAlarmState();
     virtual bool clearAlarmState();
@@ -89,6 +93,10 @@ public:
     bool WaitLessThanTargetPos(double target_position, int timeout = 10000);
     virtual bool WaitArrivedTargetPos(double target_position, double arived_error, int timeout = 10000);
     virtual bool WaitArrivedTargetPos(int timeout = 10000);
+    //反馈位置在band内保持window毫秒即认为稳定, 最长等待max_wait毫秒
+    bool WaitSettled(double band, int window, int max_wait);
+    //按参数检测稳定, 未设置稳定区间时等满max_wait
+    bool WaitSettled(int max_wait);
     virtual bool MoveToPosSync(double pos, int thread = -1, int time_out = 30000);
     virtual bool MoveToPosSync(double pos, double arrived_error, int thread = -1, int time_out = 30000);
     bool MoveToMinPosSync(int time_out = 3000);
@@ -161,6 +169,8 @@ protected:
     XtGeneralInput origin;
     XtGeneralInput origin2;
     DeviceStatesGeter *geter;
+    MotionTimingRecorder::Record timing_record;
+    QMutex timing_locker;
 
     void ChangeCurPos(double pos);
     //    void CheckLimit(double &pos);
@@ -168,12 +178,22 @@ protected:
     bool checkLimit(const double pos);
     bool getInterfaceLimit(double target_pos, double &result_pos);
     bool checkInterface(const double pos);
+    void openTimingRecord(MotionTimingRecorder::MoveType type, double start_pos, double target_pos, double vel);
+    void closeTimingRecord(double target_position, bool arrived, double settle_time = 0);
 
 public:
     static int axis_id_resource;
     QList<VerticalLimitParameter *> vertical_limit_parameters;
     QList<ParallelLimitParameter *> parallel_limit_parameters;
     QList<IOLimitParameter *> io_limit_parameters;
+    void compileLimitIndex();
+
+private:
+    MotorLimitIndex limit_index;
+    int settle_count = 0;
+    int settle_fallback_count = 0;
+    double settle_wait_time = 0;
+    double settle_saved_time = 0;
 };
 
 #endif    // XTMOTER_H
@@ -13,6 +13,8 @@ public:
     Q_PROPERTY(double positionError READ positionError WRITE setPositionError NOTIFY positionErrorChanged)
     Q_PROPERTY(bool firstCheckArrived READ firstCheckArrived WRITE setFirstCheckArrived NOTIFY firstCheckArrivedChanged)
     Q_PROPERTY(bool reverseAlarmIO READ reverseAlarmIO WRITE setReverseAlarmIO NOTIFY reverseAlarmIOChanged)
+    Q_PROPERTY(double settleBand READ settleBand WRITE setSettleBand NOTIFY settleBandChanged)
+    Q_PROPERTY(int settleWindow READ settleWindow WRITE setSettleWindow NOTIFY settleWindowChanged)
     int arrivedDelay() const
     {
         return m_arrivedDelay;
@@ -38,6 +40,16 @@ public:
         return m_reverseAlarmIO;
     }
 
+    double settleBand() const
+    {
+        return m_settleBand;
+    }
+
+    int settleWindow() const
+    {
+        return m_settleWindow;
+    }
+
 public slots:
     void setarrivedDelay(int arrivedDelay)
     {
@@ -82,6 +94,24 @@ public slots:
         emit reverseAlarmIOChanged(m_reverseAlarmIO);
     }
 
+    void setSettleBand(double settleBand)
+    {
+        if (qFuzzyCompare(m_settleBand, settleBand))
+            return;
+
+        m_settleBand = settleBand;
+        emit settleBandChanged(m_settleBand);
+    }
+
+    void setSettleWindow(int settleWindow)
+    {
+        if (m_settleWindow == settleWindow)
+            return;
+
+        m_settleWindow = settleWindow;
+        emit settleWindowChanged(m_settleWindow);
+    }
+
 signals:
     void arrivedDelayChanged(int arrivedDelay);
     void useDelayChanged(bool useDelay);
@@ -96,12 +126,18 @@ signals:
 
     void reverseAlarmIOChanged(bool reverseAlarmIO);
 
+    void settleBandChanged(double settleBand);
+
+    void settleWindowChanged(int settleWindow);
+
 private:
     int m_arrivedDelay = 100;
     bool m_useDelay = false;
     double m_positionError = 0.01;
     bool m_firstCheckArrived = false;
     bool m_reverseAlarmIO = false;
+    double m_settleBand = 0;
+    int m_settleWindow = 20;
 };
 class XtMotorState:public PropertyBase
 {
@@ -0,0 +1,334 @@
+#include "xtstatesnapshot.h"
+#include "XtGeneralInput.h"
+#include "XtGeneralOutput.h"
+#include "xtmotor.h"
+#include <cmath>
+#include <functional>
+
+XtStateSnapshot::XtStateSnapshot()
+{
+    clock.start();
+}
+
+XtStateSnapshot::~XtStateSnapshot()
+{
+    stopThd();
+}
+
+XtStateSnapshot *XtStateSnapshot::instance()
+{
+    static XtStateSnapshot snapshot;
+    return &snapshot;
+}
+
+void XtStateSnapshot::setSources(const QList<XtMotor *> &motors, const QList<XtGeneralInput *> &inputs, const QList<XtGeneralOutput *> &outputs)
+{
+    QMutexLocker tmpLocker(&locker);
+    this->motors = motors;
+    this->inputs = inputs;
+    this->outputs = outputs;
+    motorIndex.clear();
+    for (int i = 0; i < motors.size(); ++i)
+        motorIndex.insert(motors[i],i);
+    inputIndex.clear();
+    for (int i = 0; i < inputs.size(); ++i)
+        inputIndex.insert(inputs[i],i);
+    outputIndex.clear();
+    for (int i = 0; i < outputs.size(); ++i)
+        outputIndex.insert(outputs[i],i);
+    //旧快照的索引已失效, 等下一周期
+    current.readStart = -1;
+    current.readEnd = -1;
+    current.positions.clear();
+    current.inputs.clear();
+    current.outputs.clear();
+    qInfo("state snapshot sources motor %d input %d output %d",motors.size(),inputs.size(),outputs.size());
+}
+
+void XtStateSnapshot::setRefreshInterval(int interval, int max_age)
+{
+    QMutexLocker tmpLocker(&locker);
+    refreshInterval = qMax(1,interval);
+    defaultMaxAge = qMax(refreshInterval,max_age);
+}
+
+int XtStateSnapshot::defaultAge() const
+{
+    QMutexLocker tmpLocker(&locker);
+    return defaultMaxAge;
+}
+
+void XtStateSnapshot::startThd()
+{
+    if(isRunning())
+        return;
+    isRun = true;
+    start(QThread::HighPriority);
+}
+
+void XtStateSnapshot::stopThd()
+{
+    {
+        QMutexLocker tmpLocker(&locker);
+        isRun = false;
+        demand.wakeAll();
+    }
+    this->wait();
+}
+
+void XtStateSnapshot::touch() const
+{
+    //调用者持有locker; 空闲后第一次读取唤醒刷新线程
+    qint64 now = clock.nsecsElapsed()/1000;
+    if(now - lastDemand > IDLE_TIME*1000)
+        demand.wakeAll();
+    lastDemand = now;
+}
+
+XtStateSnapshot::Snapshot XtStateSnapshot::snapshot() const
+{
+    QMutexLocker tmpLocker(&locker);
+    return current;
+}
+
+qint64 XtStateSnapshot::age(const Snapshot &snapshot) const
+{
+    if(snapshot.readStart < 0)
+        return LLONG_MAX;
+    return clock.nsecsElapsed()/1000 - snapshot.readStart;
+}
+
+qint64 XtStateSnapshot::maxAge(int max_age) const
+{
+    return qint64(max_age < 0?defaultMaxAge:max_age)*1000;
+}
+
+bool XtStateSnapshot::getFeedbackPos(const XtMotor *motor, double &position, int max_age) const
+{
+    QMutexLocker tmpLocker(&locker);
+    touch();
+    int index = motorIndex.value(motor,-1);
+    if(index < 0||index >= current.positions.size()||age(current) > maxAge(max_age))
+    {
+        missCount++;
+        return false;
+    }
+    hitCount++;
+    position = current.positions[index];
+    return true;
+}
+
+double XtStateSnapshot::getFeedbackPos(const XtMotor *motor, int max_age)
+{
+    double position;
+    if(getFeedbackPos(motor,position,max_age))
+        return position;
+    return motor->GetFeedbackPos();
+}
+
+QVector<double> XtStateSnapshot::getFeedbackPos(const QList<XtMotor *> &motors, int max_age)
+{
+    QVector<double> positions;
+    {
+        QMutexLocker tmpLocker(&locker);
+        touch();
+        if(age(current) <= maxAge(max_age))
+        {
+            foreach (XtMotor *motor, motors) {
+                int index = motorIndex.value(motor,-1);
+                if(index < 0||index >= current.positions.size())
+                    break;
+                positions.append(current.positions[index]);
+            }
+        }
+        if(positions.size() == motors.size())
+        {
+            hitCount++;
+            return positions;
+        }
+        missCount++;
+    }
+    //有轴不在快照里或快照过期时全部直接读取
+    positions.clear();
+    foreach (XtMotor *motor, motors)
+        positions.append(motor->GetFeedbackPos());
+    return positions;
+}
+
+bool XtStateSnapshot::getInputState(const XtGeneralInput *input, bool &state, int max_age) const
+{
+    QMutexLocker tmpLocker(&locker);
+    touch();
+    int index = inputIndex.value(input,-1);
+    if(index < 0||index >= current.inputs.size()||age(current) > maxAge(max_age))
+    {
+        missCount++;
+        return false;
+    }
+    hitCount++;
+    state = current.inputs[index];
+    return true;
+}
+
+bool XtStateSnapshot::getOutputState(const XtGeneralOutput *output, bool &state, int max_age) const
+{
+    QMutexLocker tmpLocker(&locker);
+    touch();
+    int index = outputIndex.value(output,-1);
+    if(index < 0||index >= current.outputs.size()||age(current) > maxAge(max_age))
+    {
+        missCount++;
+        return false;
+    }
+    hitCount++;
+    state = current.outputs[index];
+    return true;
+}
+
+bool XtStateSnapshot::inputValue(XtGeneralInput *input, int max_age)
+{
+    bool state;
+    if(getInputState(input,state,max_age))
+        return state;
+    return input->Value();
+}
+
+bool XtStateSnapshot::outputValue(XtGeneralOutput *output, int max_age)
+{
+    bool state;
+    if(getOutputState(output,state,max_age))
+        return state;
+    return output->Value();
+}
+
+void XtStateSnapshot::run()
+{
+    qint64 next_cycle = clock.nsecsElapsed()/1000;
+    qint64 last_log = next_cycle;
+    statisticsStart = next_cycle;
+    while (isRun) {
+        QList<XtMotor*> temp_motors;
+        QList<XtGeneralInput*> temp_inputs;
+        QList<XtGeneralOutput*> temp_outputs;
+        qint64 interval;
+        {
+            QMutexLocker tmpLocker(&locker);
+            //没有读取者时停止刷新, 直到下一次读取
+            if(clock.nsecsElapsed()/1000 - lastDemand > IDLE_TIME*1000)
+            {
+                demand.wait(&locker);
+                next_cycle = clock.nsecsElapsed()/1000;
+                continue;
+            }
+            temp_motors = motors;
+            temp_inputs = inputs;
+            temp_outputs = outputs;
+            interval = refreshInterval*1000;
+        }
+        Snapshot snapshot;
+        snapshot.readStart = clock.nsecsElapsed()/1000;
+        snapshot.positions.reserve(temp_motors.size());
+        foreach (XtMotor *motor, temp_motors)
+            snapshot.positions.append(motor->GetFeedbackPos());
+        snapshot.inputs.reserve(temp_inputs.size());
+        foreach (XtGeneralInput *input, temp_inputs)
+            snapshot.inputs.append(input->Value());
+        snapshot.outputs.reserve(temp_outputs.size());
+        foreach (XtGeneralOutput *output, temp_outputs)
+            snapshot.outputs.append(output->Value());
+        snapshot.readEnd = clock.nsecsElapsed()/1000;
+        {
+            QMutexLocker tmpLocker(&locker);
+            //读取期间源被替换则丢弃本周期
+            if(temp_motors == motors&&temp_inputs == inputs&&temp_outputs == outputs)
+            {
+                snapshot.sequence = current.sequence + 1;
+                current = snapshot;
+            }
+        }
+
+        cycleCount++;
+        controllerReads += temp_motors.size() + temp_inputs.size() + temp_outputs.size();
+        qint64 read_time = snapshot.readEnd - snapshot.readStart;
+        readTime += read_time;
+        maxReadTime = qMax(maxReadTime,read_time);
+        maxPeriodError = qMax(maxPeriodError,qAbs(snapshot.readStart - next_cycle));
+        if(snapshot.readEnd - last_log >= 60000000)
+        {
+            logStatistics();
+            statisticsStart = snapshot.readEnd;
+            last_log = snapshot.readEnd;
+        }
+
+        next_cycle += interval;
+        qint64 now = clock.nsecsElapsed()/1000;
+        if(next_cycle < now)
+            next_cycle = now;
+        else
+            usleep(ulong(next_cycle - now));
+    }
+}
+
+void XtStateSnapshot::logStatistics()
+{
+    qint64 hit,miss;
+    {
+        QMutexLocker tmpLocker(&locker);
+        hit = hitCount;
+        miss = missCount;
+        hitCount = 0;
+        missCount = 0;
+    }
+    double seconds = qMax(qint64(1),clock.nsecsElapsed()/1000 - statisticsStart)/1000000.0;
+    qInfo("state snapshot cycles %lld avg read %lld us max read %lld us max jitter %lld us, controller reads %.1f/s, reader calls %.1f/s hit %lld miss %lld",
+          cycleCount,cycleCount > 0?readTime/cycleCount:0,maxReadTime,maxPeriodError,controllerReads/seconds,(hit + miss)/seconds,hit,miss);
+    cycleCount = 0;
+    controllerReads = 0;
+    readTime = 0;
+    maxReadTime = 0;
+    maxPeriodError = 0;
+}
+
+QString XtStateSnapshot::runBenchmark(int count)
+{
+    //对比逐轴直接读取与快照读取全部轴的调用频率和耗时抖动, 不要在生产时运行
+    QList<XtMotor*> temp_motors;
+    {
+        QMutexLocker tmpLocker(&locker);
+        temp_motors = motors;
+    }
+    if(temp_motors.isEmpty()||count <= 0)
+        return "state snapshot benchmark: no motor";
+    auto measure = [count](std::function<void()> read) {
+        QVector<double> times;
+        times.reserve(count);
+        QElapsedTimer total; total.start();
+        for (int i = 0; i < count; ++i) {
+            QElapsedTimer timer; timer.start();
+            read();
+            times.append(timer.nsecsElapsed()/1000.0);
+        }
+        double total_time = total.nsecsElapsed()/1000.0;
+        double mean = total_time/count;
+        double variance = 0,max_time = 0;
+        foreach (double time, times) {
+            variance += (time - mean)*(time - mean);
+            max_time = qMax(max_time,time);
+        }
+        return QString("%1 calls/s mean %2 us jitter(std) %3 us max %4 us")
+                .arg(count*1000000.0/qMax(1.0,total_time),0,'f',1).arg(mean,0,'f',1)
+                .arg(sqrt(variance/count),0,'f',1).arg(max_time,0,'f',1);
+    };
+    QString direct = measure([&temp_motors]() {
+        foreach (XtMotor *motor, temp_motors)
+            motor->GetFeedbackPos();
+    });
+    QString cached = measure([this,&temp_motors]() {
+        getFeedbackPos(temp_motors);
+    });
+    QString result = QString("state snapshot benchmark %1 axes x %2 reads\ndirect per axis: %3\nsnapshot: %4")
+            .arg(temp_motors.size()).arg(count).arg(direct).arg(cached);
+    foreach (QString line, result.split("\n"))
+        qInfo("%s",line.toStdString().c_str());
+    return result;
+}
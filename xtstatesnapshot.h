@@ -0,0 +1,102 @@
+#ifndef XTSTATESNAPSHOT_H
+#define XTSTATESNAPSHOT_H
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QThread>
+#include <QVector>
+#include <QWaitCondition>
+#include <climits>
+
+class XtMotor;
+class XtGeneralInput;
+class XtGeneralOutput;
+
+/*
+ * Periodic snapshot of all axis feedback positions and io states.
+ * One thread reads every registered axis and io per cycle and publishes
+ * the values as a whole, so readers of several axes get values from the
+ * same cycle without a controller round trip each. A reader passes the
+ * oldest age it accepts; an older or missing value falls back to a direct
+ * read of the axis. The thread only refreshes while readers have asked
+ * for values within the last IDLE_TIME ms, so an unused service adds no
+ * controller traffic.
+ */
+class XtStateSnapshot:public QThread
+{
+    Q_OBJECT
+
+public:
+    struct Snapshot
+    {
+        quint64 sequence = 0;
+        qint64 readStart = -1;      //本周期开始读取的时间, us
+        qint64 readEnd = -1;
+        QVector<double> positions;
+        QVector<bool> inputs;
+        QVector<bool> outputs;
+    };
+
+    static XtStateSnapshot *instance();
+    ~XtStateSnapshot() override;
+
+    void setSources(const QList<XtMotor*> &motors, const QList<XtGeneralInput*> &inputs, const QList<XtGeneralOutput*> &outputs);
+    void setRefreshInterval(int interval, int max_age);
+    int defaultAge() const;
+    void startThd();
+    void stopThd();
+
+    Snapshot snapshot() const;
+    qint64 age(const Snapshot &snapshot) const;
+    //max_age小于0时使用设置的默认值, ms
+    bool getFeedbackPos(const XtMotor *motor, double &position, int max_age = -1) const;
+    double getFeedbackPos(const XtMotor *motor, int max_age = -1);
+    QVector<double> getFeedbackPos(const QList<XtMotor*> &motors, int max_age = -1);
+    bool getInputState(const XtGeneralInput *input, bool &state, int max_age = -1) const;
+    bool getOutputState(const XtGeneralOutput *output, bool &state, int max_age = -1) const;
+    //快照中没有或过期时直接读取
+    bool inputValue(XtGeneralInput *input, int max_age = -1);
+    bool outputValue(XtGeneralOutput *output, int max_age = -1);
+    QString runBenchmark(int count = 2000);
+
+protected:
+    void run() override;
+
+private:
+    explicit XtStateSnapshot();
+    void logStatistics();
+
+    qint64 maxAge(int max_age) const;
+    void touch() const;
+
+    const qint64 IDLE_TIME = 1000;
+
+    bool isRun = false;
+    int refreshInterval = 5;
+    int defaultMaxAge = 20;
+    QElapsedTimer clock;
+    QList<XtMotor*> motors;
+    QList<XtGeneralInput*> inputs;
+    QList<XtGeneralOutput*> outputs;
+    QHash<const XtMotor*,int> motorIndex;
+    QHash<const XtGeneralInput*,int> inputIndex;
+    QHash<const XtGeneralOutput*,int> outputIndex;
+    mutable QMutex locker;
+    mutable QWaitCondition demand;
+    mutable qint64 lastDemand = LLONG_MIN/2;    //最近一次读取的时间, us
+    Snapshot current;
+
+    //刷新周期和读取者命中的统计, 定期打印
+    qint64 cycleCount = 0;
+    qint64 controllerReads = 0;
+    qint64 statisticsStart = 0;
+    qint64 readTime = 0;
+    qint64 maxReadTime = 0;
+    qint64 maxPeriodError = 0;
+    mutable qint64 hitCount = 0;
+    mutable qint64 missCount = 0;
+};
+
+#endif // XTSTATESNAPSHOT_H
@@ -19,6 +19,7 @@ public:
     Q_PROPERTY(int checkOutTime READ checkOutTime WRITE setCheckOutTime NOTIFY checkOutTimeChanged)
     Q_PROPERTY(bool reserveValue READ reserveValue WRITE setReserveValue NOTIFY reserveValueChanged)
     Q_PROPERTY(int excuteTime READ excuteTime WRITE setExcuteTime NOTIFY excuteTimeChanged)
+    Q_PROPERTY(int debounceTime READ debounceTime WRITE setDebounceTime NOTIFY debounceTimeChanged)
     QString vacuumName() const
     {
         return m_vacuumName;
@@ -63,6 +64,11 @@ public:
         return m_excuteTime;
     }
 
+    int debounceTime() const
+    {
+        return m_debounceTime;
+    }
+
 public slots:
     void setVacuumName(QString vacuumName)
     {
@@ -144,6 +150,15 @@ public slots:
         emit excuteTimeChanged(m_excuteTime);
     }
 
+    void setDebounceTime(int debounceTime)
+    {
+        if (m_debounceTime == debounceTime)
+            return;
+
+        m_debounceTime = debounceTime;
+        emit debounceTimeChanged(m_debounceTime);
+    }
+
 signals:
     void vacuumNameChanged(QString vacuumName);
     void outIoNameChanged(QString outIoName);
@@ -162,6 +177,8 @@ signals:
 
     void excuteTimeChanged(int excuteTime);
 
+    void debounceTimeChanged(int debounceTime);
+
 private:
     QString m_vacuumName = "Vcauum";
     QString m_outIoName = "";
@@ -172,6 +189,7 @@ private:
     int m_checkOutTime = 200;
     bool m_reserveValue = false;
     int m_excuteTime = 100;
+    int m_debounceTime = 0;
 };
 
 #endif // XTVACUUMPARAMETER_H